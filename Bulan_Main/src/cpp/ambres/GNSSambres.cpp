@@ -1,8 +1,14 @@
 
 #include "GNSSambres.hpp"
 #include "testUtils.hpp"
+#include "parallel.hpp"
 
+#include <algorithm>
+#include <sstream>
 #include <math.h>
+#include <utility>
+
+using std::pair;
 
 #define LOG_PI          1.14472988584940017
 #define SQRT2           1.41421356237309510
@@ -236,19 +242,20 @@ int Ztrans_reduction(
 			D(j)   = eta * D(j+1);
 			D(j+1) = del;
 
-			MatrixXd a0 = L.block(j,   0, 1, j);
-    		MatrixXd a1 = L.block(j+1, 0, 1, j);
-    		L.block(j,   0, 1, j) = a1 - L(j+1,j)*a0;
-			L.block(j+1, 0, 1, j) = lam*a1 + eta*a0;
+			//update rows in place, without temporary copies
+			double Lj1j = L(j+1,j);
+			for (int c = 0; c < j; c++)
+			{
+				double a0 = L(j,   c);
+				double a1 = L(j+1, c);
+				L(j,   c) = a1 - Lj1j*a0;
+				L(j+1, c) = lam*a1 + eta*a0;
+			}
 			L(j+1,j) = lam;
 
-			VectorXd Ltmp = L.block(j+2, j, n-j-2, 1);
-			L.block(j+2, j,   n-j-2, 1) = L.block(j+2, j+1, n-j-2, 1);
-			L.block(j+2, j+1, n-j-2, 1) = Ltmp;
+			L.block(j+2, j, n-j-2, 1).swap(L.block(j+2, j+1, n-j-2, 1));
 
-			VectorXd Ztmp = Z.col(j);
-			Z.col(j)   = Z.col(j+1);
-			Z.col(j+1) = Ztmp;
+			Z.col(j).swap(Z.col(j+1));
 
 			k=j;
 			j=n-2;
@@ -399,7 +406,9 @@ int lambda_search(
 
 	int kmin=kmax-zsiz+1;
 
-	map<double, VectorXd> zfixList;
+	//candidates sorted by distance, bounded by the candidate set size
+	vector<pair<double, VectorXd>> zfixList;
+	zfixList.reserve(std::max(opt.nset, 1) + 1);
 
 	MatrixXd L = mtrx.Ltrs;
 	VectorXd D = mtrx.Dtrs;
@@ -442,7 +451,22 @@ int lambda_search(
 			else
 			{
 				VectorXd zcut = zfix.tail(zsiz);
-				zfixList[newdist] = zcut;
+
+				auto it = std::lower_bound(zfixList.begin(), zfixList.end(), newdist, [](const pair<double, VectorXd>& candidate, double dist)
+				{
+					return candidate.first < dist;
+				});
+
+				if	(  it != zfixList.end()
+					&& it->first == newdist)
+				{
+					it->second = zcut;
+				}
+				else
+				{
+					zfixList.insert(it, {newdist, zcut});
+				}
+
 				ncand = zfixList.size();
 				double maxd = newdist * opt.ratthr;
 
@@ -456,18 +480,13 @@ int lambda_search(
 				if (opt.nset>0
 				&& (ncand >= opt.nset))
 				{
-					int ntot = 0;
-					for (auto it = zfixList.begin(); it != zfixList.end(); )
+					if (zfixList.size() > opt.nset)
 					{
-						if (ntot++ >= opt.nset)
-							it = zfixList.erase(it);
-						else
-						{
-							maxd = it->first;
-							++it;
-						}
+						zfixList.resize(opt.nset);
 					}
 
+					maxd = zfixList.back().first;
+
 					if(maxd < maxdist)
 						maxdist = maxd;
 
@@ -604,3 +623,72 @@ int GNSS_AR(
 
 	return 0;
 }
+
+/** Independent subset of ambiguities, resolved separately from the others */
+struct ArGroup
+{
+	vector<int>			indices;		///< Indices of the subset's ambiguities in the full ambiguity vector
+	GinAR_mtx			mtrx;			///< Float values and results for the subset only
+	std::stringstream	trace;			///< Buffered trace output, written out in subset order
+	int					nfix = 0;		///< Number of fixed (transformed) ambiguities
+};
+
+/** Ambiguity resolution of independent subsets of the ambiguity vector.
+ * Subsets are resolved on separate threads, and merged in list order so that the fixed solution does not depend on scheduling.
+ * The merged Z transformation is block structured, each row only acting on the ambiguities of its own subset.
+ */
+int GNSS_AR(
+	Trace&						trace,		///< Debug trace
+	GinAR_mtx&					mtrx,		///< Reference to structure containing float values and covariance
+	GinAR_opt					opt,		///< Object containing processing options
+	const vector<vector<int>>&	groupList)	///< Lists of indices into the ambiguity vector, one list per independent subset
+{
+	vector<ArGroup> arGroupList(groupList.size());
+
+	for (int g = 0; g < groupList.size(); g++)
+	{
+		auto& arGroup = arGroupList[g];
+
+		arGroup.indices		= groupList[g];
+		arGroup.mtrx.aflt	= mtrx.aflt	(arGroup.indices);
+		arGroup.mtrx.Paflt	= mtrx.Paflt(arGroup.indices, arGroup.indices);
+	}
+
+	parallelForEach(arGroupList, [&](ArGroup& arGroup)
+	{
+		arGroup.nfix = GNSS_AR(arGroup.trace, arGroup.mtrx, opt);
+	});
+
+	int nx = mtrx.aflt.size();
+	int nz = 0;
+	for (auto& arGroup : arGroupList)
+	{
+		if (arGroup.nfix > 0)
+			nz += arGroup.mtrx.zfix.size();
+	}
+
+	mtrx.Ztrs = MatrixXd::Zero(nz, nx);
+	mtrx.zfix = VectorXd::Zero(nz);
+
+	int row = 0;
+	for (auto& arGroup : arGroupList)
+	{
+		trace << arGroup.trace.str();
+
+		if (arGroup.nfix <= 0)
+			continue;
+
+		int rows = arGroup.mtrx.zfix.size();
+
+		mtrx.zfix.segment(row, rows) = arGroup.mtrx.zfix;
+
+		for (int c = 0; c < arGroup.indices.size(); c++)
+		{
+			mtrx.Ztrs.block(row, arGroup.indices[c], rows, 1) = arGroup.mtrx.Ztrs.col(c);
+		}
+
+		row += rows;
+	}
+
+	return nz;
+}
@@ -55,3 +55,4 @@ struct GinAR_opt
 };
 
 int		GNSS_AR(Trace& trace, GinAR_mtx& mtrx, GinAR_opt opt);
+int		GNSS_AR(Trace& trace, GinAR_mtx& mtrx, GinAR_opt opt, const vector<vector<int>>& groupList);
@@ -1761,6 +1761,11 @@ ReceiverOptions& ReceiverOptions::operator+=(
 	initIfNeeded(*this, rhs,	tideModels.atl					);
 	initIfNeeded(*this, rhs,	tideModels.spole				);
 	initIfNeeded(*this, rhs,	tideModels.opole				);
+	initIfNeeded(*this, rhs,	tideModels.solid_node_spacing	);
+	initIfNeeded(*this, rhs,	tideModels.otl_node_spacing		);
+	initIfNeeded(*this, rhs,	tideModels.atl_node_spacing		);
+	initIfNeeded(*this, rhs,	tideModels.spole_node_spacing	);
+	initIfNeeded(*this, rhs,	tideModels.opole_node_spacing	);
 
 	initIfNeeded(*this, rhs,	range							);
 	initIfNeeded(*this, rhs,	relativity						);
@@ -2147,6 +2152,11 @@ void getOptionsFromYaml(
 	}{	auto& thing = recOpts.tideModels.atl				;	setInited(recOpts,	thing,	tryGetFromYaml	(thing,	modelsNode,	{"@ tides",						"@ atl"			}, "Enable atmospheric tide loading"));
 	}{	auto& thing = recOpts.tideModels.spole				;	setInited(recOpts,	thing,	tryGetFromYaml	(thing,	modelsNode,	{"@ tides",						"@ spole"		}, "Enable solid Earth pole tides"));
 	}{	auto& thing = recOpts.tideModels.opole				;	setInited(recOpts,	thing,	tryGetFromYaml	(thing,	modelsNode,	{"@ tides",						"@ opole"		}, "Enable ocean pole tides"));
+	}{	auto& thing = recOpts.tideModels.solid_node_spacing	;	setInited(recOpts,	thing,	tryGetFromYaml	(thing,	modelsNode,	{"@ tides",						"@ solid_node_spacing"	}, "Spacing (s) of nodes that solid Earth tides are interpolated from, 0 to evaluate at every epoch"));
+	}{	auto& thing = recOpts.tideModels.otl_node_spacing	;	setInited(recOpts,	thing,	tryGetFromYaml	(thing,	modelsNode,	{"@ tides",						"@ otl_node_spacing"	}, "Spacing (s) of nodes that ocean tide loading is interpolated from, 0 to evaluate at every epoch"));
+	}{	auto& thing = recOpts.tideModels.atl_node_spacing	;	setInited(recOpts,	thing,	tryGetFromYaml	(thing,	modelsNode,	{"@ tides",						"@ atl_node_spacing"	}, "Spacing (s) of nodes that atmospheric tide loading is interpolated from, 0 to evaluate at every epoch"));
+	}{	auto& thing = recOpts.tideModels.spole_node_spacing	;	setInited(recOpts,	thing,	tryGetFromYaml	(thing,	modelsNode,	{"@ tides",						"@ spole_node_spacing"	}, "Spacing (s) of nodes that solid Earth pole tides are interpolated from, 0 to evaluate at every epoch"));
+	}{	auto& thing = recOpts.tideModels.opole_node_spacing	;	setInited(recOpts,	thing,	tryGetFromYaml	(thing,	modelsNode,	{"@ tides",						"@ opole_node_spacing"	}, "Spacing (s) of nodes that ocean pole tides are interpolated from, 0 to evaluate at every epoch"));
 
 	}{	auto& thing = recOpts.range							;	setInited(recOpts,	thing,	tryGetFromYaml	(thing,	modelsNode,	{"@ range",						"@ enable"		}, "Enable modelling of signal time of flight time due to range"));
 	}{	auto& thing = recOpts.relativity					;	setInited(recOpts,	thing,	tryGetFromYaml	(thing,	modelsNode,	{"@ relativity",				"@ enable"		}, "Enable modelling of relativistic effects"));
@@ -2601,6 +2611,7 @@ bool configure(
 	("compare_clocks",																					"Compare clock files")
 	("compare_orbits",																					"Compare sp3 files")
 	("compare_attitudes",																				"Compare antex files")
+	("benchmark_file",					boost::program_options::value<string>(),						"Output file for per-stage timing of pea_bench builds")
 	;
 
 	boost::program_options::variables_map vm;
@@ -2655,6 +2666,8 @@ bool configure(
 		}
 	}
 
+	tryGetFromOpts(acsConfig.benchmark_filename,	vm, {"benchmark_file"});
+
 	if	( acsConfig.compare_clocks
 		||vm.count("compare_clocks"))
 	{
@@ -3765,6 +3778,7 @@ bool ACSConfig::parse(
 
 				tryGetFromYaml(ambrOpts.once_per_epoch,		ambiguity_resolution, {"@ once_per_epoch"				},	"Perform ambiguity resolution on a temporary filter and output results once per epoch");
 				tryGetFromYaml(ambrOpts.fix_and_hold,		ambiguity_resolution, {"@ fix_and_hold"					},	"Perform ambiguity resolution and commit results to the main processing filter");
+				tryGetFromYaml(ambrOpts.resolve_by_system,	ambiguity_resolution, {"@ resolve_by_system"			},	"Resolve the ambiguities of each satellite system as an independent subset, subsets are resolved in parallel");
 			}
 
 
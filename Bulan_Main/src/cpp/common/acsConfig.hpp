@@ -350,6 +350,8 @@ struct DebugOptions
 	bool	compare_attitudes			= false;
 
 	bool	check_broadcast_differences	= false;
+
+	string	benchmark_filename			= "pea_bench.json";
 };
 
 /** Options for processing SLR observations
@@ -711,6 +713,7 @@ struct AmbROptions
 
 	bool	once_per_epoch			= true;
 	bool	fix_and_hold			= false;
+	bool	resolve_by_system		= false;	///< Resolve the ambiguities of each satellite system as an independent subset
 };
 
 /** Rinex 2 conversions for individual receivers
@@ -1165,6 +1168,12 @@ struct ReceiverOptions : ReceiverKalmans, CommonOptions
 		bool	atl			= true;
 		bool	spole		= true;
 		bool	opole		= true;
+
+		double	solid_node_spacing	= 0;		///< Spacing of nodes that solid Earth tides are interpolated from (s), 0 to evaluate at every epoch
+		double	otl_node_spacing	= 0;		///< Spacing of nodes that ocean tide loading is interpolated from (s), 0 to evaluate at every epoch
+		double	atl_node_spacing	= 0;		///< Spacing of nodes that atmospheric tide loading is interpolated from (s), 0 to evaluate at every epoch
+		double	spole_node_spacing	= 0;		///< Spacing of nodes that solid Earth pole tides are interpolated from (s), 0 to evaluate at every epoch
+		double	opole_node_spacing	= 0;		///< Spacing of nodes that ocean pole tides are interpolated from (s), 0 to evaluate at every epoch
 	} tideModels;
 
 	bool range					= true;
@@ -3,6 +3,12 @@
 
 #include <iostream>
 #include <vector>
+#include <tuple>
+#include <map>
+
+using std::vector;
+using std::tuple;
+using std::map;
 
 #include "observations.hpp"
 #include "navigation.hpp"
@@ -70,87 +76,158 @@ bool satFreqs(
 
 	return true;
 }
-/** Detect cycle slip by reported loss of lock
+/** Linear combination values of an observation, gathered for the combination based slip detectors
 */
-void detslp_ll(
-	Trace&		trace,		///< Trace to output to
-	ObsList&	obsList)	///< List of observations to detect slips within
+struct SlipLcEntry
 {
-	tracepdeex(5, trace, "\n%s: n=%d", __FUNCTION__, obsList.size());
+	GObs*		obs_ptr;		///< Observation these values were gathered from
+	E_FType		frq1;			///< First frequency of the combinations
+	E_FType		frq2;			///< Second frequency of the combinations
+	double		gf0;			///< Geometry free combination at previous epoch (m)
+	double		gf1;			///< Geometry free combination at this epoch (m), zero if unavailable
+	double		mw0;			///< Melbourne-Wubbena combination at previous epoch (m)
+	double		mw1;			///< Melbourne-Wubbena combination at this epoch (m), zero if unavailable
+};
+
+/** Phase signal with a loss of lock reported by the receiver, gathered for the loss of lock slip detector
+*/
+struct SlipLliEntry
+{
+	GObs*		obs_ptr;		///< Observation this signal was gathered from
+	E_FType		ft;				///< Frequency of the signal
+};
 
-// 	auto begin_iter = boost::make_filter_iterator([]
+/** Values of all observations of a receiver used by the slip detectors, gathered into contiguous lists
+*/
+struct SlipData
+{
+	vector<SlipLcEntry>		lcEntries;		///< Combinations for the geometry free and Melbourne-Wubbena detectors
+	vector<SlipLliEntry>	lliEntries;		///< Signals with reported loss of lock
+};
 
-	for (auto& obs			: only<GObs>(obsList))
-	for (auto& [ft, sig]	: obs.sigs)
+/** Gather the values used by the slip detectors for all observations in a single pass.
+* Frequencies are resolved once per system, and each combination is looked up once per observation rather than once per detector
+*/
+SlipData gatherSlipData(
+	ObsList&	obsList)	///< List of observations to gather values from
+{
+	SlipData slipData;
+	auto& entries = slipData.lcEntries;
+	entries.reserve(obsList.size());
+
+	map<E_Sys, tuple<bool, E_FType, E_FType>> sysFreqsMap;
+
+	for (auto& obs : only<GObs>(obsList))
 	{
 		if (obs.exclude)
 		{
 			continue;
 		}
 
-		int f = ft;
-		if	( sig.L == 0
-			|| (sig.LLI & 0x03) == 0)
+		for (auto& [ft, sig] : obs.sigs)
 		{
-			continue;
+			if	( sig.L == 0
+				|| (sig.LLI & 0x03) == 0)
+			{
+				continue;
+			}
+
+			slipData.lliEntries.push_back({&obs, ft});
+		}
+
+		auto it = sysFreqsMap.find(obs.Sat.sys);
+		if (it == sysFreqsMap.end())
+		{
+			E_FType	frq1;
+			E_FType	frq2;
+			E_FType frq3;
+			bool pass = satFreqs(obs.Sat.sys, frq1, frq2, frq3);
+
+			it = sysFreqsMap.insert({obs.Sat.sys, {pass, frq1, frq2}}).first;
 		}
 
-		tracepdeex(3, trace, "\n%s: slip detected sat=%s f=F%d\n", __FUNCTION__, obs.Sat.id().c_str(), ft);
+		auto& [pass, frq1, frq2] = it->second;
+		if (pass == false)
+			continue;
+
+		S_LC& lc = getLC(obs.satStat_ptr->lc_new, frq1, frq2);
+
+		SlipLcEntry entry;
+		entry.obs_ptr	= &obs;
+		entry.frq1		= frq1;
+		entry.frq2		= frq2;
+		entry.gf0		= obs.satStat_ptr->gf;
+		entry.mw0		= obs.satStat_ptr->mw;
+
+		if (lc.valid)	{	entry.gf1 = lc.GF_Phas_m;	entry.mw1 = lc.MW_c;	}
+		else			{	entry.gf1 = 0;				entry.mw1 = 0;			}
+
+		entries.push_back(entry);
+	}
+
+	return slipData;
+}
+
+/** Detect cycle slip by reported loss of lock
+*/
+void detslp_ll(
+	Trace&					trace,		///< Trace to output to
+	vector<SlipLliEntry>&	entries)	///< Gathered signals with reported loss of lock
+{
+	tracepdeex(5, trace, "\n%s: n=%d", __FUNCTION__, entries.size());
+
+	for (auto& entry : entries)
+	{
+		auto& obs = *entry.obs_ptr;
+
+		tracepdeex(3, trace, "\n%s: slip detected sat=%s f=F%d\n", __FUNCTION__, obs.Sat.id().c_str(), entry.ft);
+
+		auto& sigStat = obs.satStat_ptr->sigStatMap[ft2string(entry.ft)];
 
-		obs.satStat_ptr->sigStatMap[ft2string(ft)].slip.		LLI = true;
-		obs.satStat_ptr->sigStatMap[ft2string(ft)].savedSlip.	LLI = true;
+		sigStat.slip.		LLI = true;
+		sigStat.savedSlip.	LLI = true;
 	}
 }
 
 /** Detect cycle slip by geometry free phase jump
 */
 void detslp_gf(
-	Trace&		trace,		///< Trace to output to
-	ObsList&	obsList)	///< List of observations to detect slips within
+	Trace&					trace,		///< Trace to output to
+	vector<SlipLcEntry>&	entries)	///< Gathered combinations to detect slips within
 {
-	tracepdeex(5, trace, "\n%s: n=%d", __FUNCTION__, obsList.size());
+	tracepdeex(5, trace, "\n%s: n=%d", __FUNCTION__, entries.size());
 
-	for (auto& obs : only<GObs>(obsList))
+	double threshold = acsConfig.preprocOpts.slip_threshold;
+
+	for (auto& entry : entries)
 	{
-		if (obs.exclude)
+		if (entry.gf1 == 0)
 		{
 			continue;
 		}
 
-		E_FType	frq1;
-		E_FType	frq2;
-		E_FType frq3;
-		bool pass = satFreqs(obs.Sat.sys, frq1, frq2, frq3);
-		if (pass == false)
-			continue;
+		auto& obs = *entry.obs_ptr;
 
-		S_LC& lc = getLC(obs.satStat_ptr->lc_new, frq1, frq2);
+		obs.satStat_ptr->gf = entry.gf1;
 
-		double gf1 = lc.GF_Phas_m;
-		if	( lc.valid	== false
-			||gf1		== 0)
+		if (entry.gf0 == 0)
 		{
 			continue;
 		}
 
-		double gf0 = obs.satStat_ptr->gf;
-		obs.satStat_ptr->gf = gf1;
+		tracepdeex(5, trace, "\n%s: sat=%s gf0=%f gf1=%f", __FUNCTION__, obs.Sat.id().c_str(), entry.gf0, entry.gf1);
 
-		if (gf0 == 0)
+		if (fabs(entry.gf1 - entry.gf0) > threshold)
 		{
-			continue;
-		}
+			tracepdeex(3, trace, "\n%s: slip detected: sat=%s gf0=%f gf1=%f", __FUNCTION__, obs.Sat.id().c_str(), entry.gf0, entry.gf1);
 
-		tracepdeex(5, trace, "\n%s: sat=%s gf0=%f gf1=%f", __FUNCTION__, obs.Sat.id().c_str(), gf0, gf1);
-
-		if (fabs(gf1 - gf0) > acsConfig.preprocOpts.slip_threshold)
-		{
-			tracepdeex(3, trace, "\n%s: slip detected: sat=%s gf0=%f gf1=%f", __FUNCTION__, obs.Sat.id().c_str(), gf0, gf1);
+			auto& sigStat1 = obs.satStat_ptr->sigStatMap[ft2string(entry.frq1)];
+			auto& sigStat2 = obs.satStat_ptr->sigStatMap[ft2string(entry.frq2)];
 
-			obs.satStat_ptr->sigStatMap[ft2string(frq1)].slip.		GF = true;
-			obs.satStat_ptr->sigStatMap[ft2string(frq2)].slip.		GF = true;
-			obs.satStat_ptr->sigStatMap[ft2string(frq1)].savedSlip.	GF = true;
-			obs.satStat_ptr->sigStatMap[ft2string(frq2)].savedSlip.	GF = true;
+			sigStat1.slip.		GF = true;
+			sigStat2.slip.		GF = true;
+			sigStat1.savedSlip.	GF = true;
+			sigStat2.savedSlip.	GF = true;
 		}
 	}
 }
@@ -158,52 +235,40 @@ void detslp_gf(
 /** Detect slip by Melbourne-Wubbena linear combination jump
 */
 void detslp_mw(
-	Trace&		trace,		///< Trace to output to
-	ObsList&	obsList)	///< List of observations to detect slips within
+	Trace&					trace,		///< Trace to output to
+	vector<SlipLcEntry>&	entries)	///< Gathered combinations to detect slips within
 {
-	tracepdeex(5, trace, "\n%s: n=%d", __FUNCTION__, obsList.size());
+	tracepdeex(5, trace, "\n%s: n=%d", __FUNCTION__, entries.size());
 
-	for (auto& obs : only<GObs>(obsList))
+	for (auto& entry : entries)
 	{
-		if (obs.exclude)
+		if (entry.mw1 == 0)
 		{
 			continue;
 		}
 
-		E_FType	frq1;
-		E_FType	frq2;
-		E_FType frq3;
-		bool pass = satFreqs(obs.Sat.sys, frq1, frq2, frq3);
-		if (pass == false)
-			continue;
+		auto& obs = *entry.obs_ptr;
 
-		S_LC& lc = getLC(obs.satStat_ptr->lc_new, frq1, frq2);
+		obs.satStat_ptr->mw = entry.mw1;
 
-		double mw1 = lc.MW_c;
-		if	( lc.valid	== false
-			||mw1		== 0)
+		if (entry.mw0 == 0)
 		{
 			continue;
 		}
 
-		double mw0 = obs.satStat_ptr->mw;
-		obs.satStat_ptr->mw = mw1;
+		tracepdeex(5, trace, "\n%s: sat=%s mw0=%f mw1=%f", __FUNCTION__, obs.Sat.id().c_str(), entry.mw0, entry.mw1);
 
-		if (mw0 == 0)
+		if (fabs(entry.mw1 - entry.mw0) > THRES_MW_JUMP)
 		{
-			continue;
-		}
-
-		tracepdeex(5, trace, "\n%s: sat=%s mw0=%f mw1=%f", __FUNCTION__, obs.Sat.id().c_str(), mw0, mw1);
+			tracepdeex(3, trace, "\n%s: slip detected: sat=%s mw0=%f mw1=%f", __FUNCTION__, obs.Sat.id().c_str(), entry.mw0, entry.mw1);
 
-		if (fabs(mw1 - mw0) > THRES_MW_JUMP)
-		{
-			tracepdeex(3, trace, "\n%s: slip detected: sat=%s mw0=%f mw1=%f", __FUNCTION__, obs.Sat.id().c_str(), mw0, mw1);
+			auto& sigStat1 = obs.satStat_ptr->sigStatMap[ft2string(entry.frq1)];
+			auto& sigStat2 = obs.satStat_ptr->sigStatMap[ft2string(entry.frq2)];
 
-			obs.satStat_ptr->sigStatMap[ft2string(frq1)].slip.		MW = true;
-			obs.satStat_ptr->sigStatMap[ft2string(frq2)].slip.		MW = true;
-			obs.satStat_ptr->sigStatMap[ft2string(frq1)].savedSlip.	MW = true;
-			obs.satStat_ptr->sigStatMap[ft2string(frq2)].savedSlip.	MW = true;
+			sigStat1.slip.		MW = true;
+			sigStat2.slip.		MW = true;
+			sigStat1.savedSlip.	MW = true;
+			sigStat2.savedSlip.	MW = true;
 		}
 	}
 }
@@ -854,9 +919,11 @@ void detectslips(
 {
 	tracepdeex(2, trace, "\n   *-------- PDE cycle slip detection & repair --------*\n");
 
-	detslp_ll(trace, obsList);
-	detslp_gf(trace, obsList);
-	detslp_mw(trace, obsList);
+	auto slipData = gatherSlipData(obsList);
+
+	detslp_ll(trace, slipData.lliEntries);
+	detslp_gf(trace, slipData.lcEntries);
+	detslp_mw(trace, slipData.lcEntries);
 
 	tracepdeex(2, trace, "\nPDE-CS GPST       week      sec  prn   el   lamw     gf12    mw12    siggf  sigmw  lamew     gf25    mw25               LC                   N1   N2   N5\n");
 
@@ -36,11 +36,3 @@ void detectslips(
 	Trace&		trace,
 	ObsList&	obsList);
 
-void detslp_gf(
-	ObsList&	obsList);
-
-void detslp_mw(
-	ObsList&	obsList);
-
-void detslp_ll(
-	ObsList& obsList);
@@ -46,6 +46,7 @@ using std::pair;
 #include "interactiveTerminal.hpp"
 #include "eigenIncluder.hpp"
 #include "algebraTrace.hpp"
+#include "benchmark.hpp"
 #include "mongoWrite.hpp"
 #include "acsConfig.hpp"
 #include "constants.hpp"
@@ -1184,17 +1185,22 @@ KFMeas::KFMeas(
 	metaDataMaps	.resize(numMeas);
 	componentsMaps	.resize(numMeas);
 
+	//index the entries so that each measurement is reached in constant time
+	vector<KFMeasEntry*> kfEntryPtrList;
+	kfEntryPtrList.reserve(kfEntryList.size());
+
+	for (auto& entry : kfEntryList)
+	{
+		kfEntryPtrList.push_back(&entry);
+	}
+
 	bool error = false;
 #	ifdef ENABLE_PARALLELISATION
-		Eigen::setNbThreads(1);
 #		pragma omp parallel for
 #	endif
-	for (int meas = 0; meas < kfEntryList.size(); meas++)
+	for (int meas = 0; meas < kfEntryPtrList.size(); meas++)
 	{
-		auto it = kfEntryList.begin();
-		std::advance(it, meas);
-
-		auto& entry = *it;
+		auto& entry = *kfEntryPtrList[meas];
 
 		R(meas, meas)	= entry.noise;
 
@@ -1255,7 +1261,6 @@ KFMeas::KFMeas(
 		metaDataMaps	[meas] = std::move(entry.metaDataMap);
 		componentsMaps	[meas] = std::move(entry.componentsMap);
 	}
-	Eigen::setNbThreads(0);
 
 	if (error)
 	{
@@ -1338,6 +1343,8 @@ void KFState::filterKalman(
 {
 	DOCS_REFERENCE(Kalman_Filter__);
 
+	BenchmarkTimer benchmarkTimer("filterKalman");
+
 	if (kfMeas.time != GTime::noTime())
 	{
 		time = kfMeas.time;
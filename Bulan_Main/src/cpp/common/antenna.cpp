@@ -192,26 +192,72 @@ Vector3d makeAntPco(
 	return pco3;
 }
 
+/** Find the pco and pcv entries for an antenna once, so that later lookups for each signal can skip the search by name
+ */
+void resolveAntennaHandle(
+			AntennaHandle&	handle,		///< Handle to update
+	const	string&			id)			///< Antenna id to find
+{
+	if	(  handle.id == id
+		&& handle.pcoSysFreqMap_ptr
+		&& handle.pcvSysFreqMap_ptr)
+	{
+		return;
+	}
+
+	handle.id					= id;
+	handle.pcoSysFreqMap_ptr	= nullptr;
+	handle.pcvSysFreqMap_ptr	= nullptr;
+
+	auto pcoIt = nav.pcoMap.find(id);
+	if (pcoIt != nav.pcoMap.end())
+	{
+		handle.pcoSysFreqMap_ptr = &pcoIt->second;
+	}
+
+	auto pcvIt = nav.pcvMap.find(id);
+	if (pcvIt != nav.pcvMap.end())
+	{
+		handle.pcvSysFreqMap_ptr = &pcvIt->second;
+	}
+}
+
 /** fetch pco
  */
 Vector3d antPco(
-	string		id,
-	E_Sys		sys,
-	E_FType		ft,
-	GTime		time,
-	double&		var,
-	E_Radio		radio,
-	bool		interp)
+	const	string&			id,				///< antenna id
+			E_Sys			sys,			///< satellite system
+			E_FType			ft,				///< frequency
+			GTime			time,			///< time
+			double&			var,			///< variance of pco
+			E_Radio			radio,			///< whether to return the transmitter or receiver pco
+			bool			interp,			///< option to interpolate pcos from other frequencies if not available
+	const	AntennaHandle*	handle_ptr)		///< optional previously resolved antenna entries
 {
-	auto it0 = nav.pcoMap.find(id);
-	if (it0 == nav.pcoMap.end())
+	PcoSysFreqMap* pcoSysFreqMap_ptr = nullptr;
+
+	if	(  handle_ptr
+		&& handle_ptr->id == id)
+	{
+		pcoSysFreqMap_ptr = handle_ptr->pcoSysFreqMap_ptr;
+	}
+	else
+	{
+		auto it0 = nav.pcoMap.find(id);
+		if (it0 != nav.pcoMap.end())
+		{
+			pcoSysFreqMap_ptr = &it0->second;
+		}
+	}
+
+	if (pcoSysFreqMap_ptr == nullptr)
 	{
 		BOOST_LOG_TRIVIAL(warning) << "Warning: No PCO found for '" << id << "'";
 
 		return Vector3d::Zero();
 	}
 
-	auto& [dummy0, pcoSysFreqMap] = *it0;
+	auto& pcoSysFreqMap = *pcoSysFreqMap_ptr;
 
 	vector<E_Sys>	testSyss	= {sys};
 	vector<E_FType>	testFts		= {ft};
@@ -300,14 +346,15 @@ Vector3d antPco(
 /** find and interpolate antenna pcv
 */
 double antPcv(
-	string		id,			///< antenna id
-	E_Sys		sys,		///< satellite system
-	E_FType		ft,			///< frequency
-	GTime		time,		///< time
-	AttStatus&	attStatus,	///< Orientation of antenna
-	VectorEcef	e,			///< Line of sight vector
-	double*		az_ptr,		///< Optional pointer to output antenna frame azimuth in degrees
-	double*		zen_ptr)	///< Optional pointer to output antenna frame zenith in degrees
+	const	string&			id,				///< antenna id
+			E_Sys			sys,			///< satellite system
+			E_FType			ft,				///< frequency
+			GTime			time,			///< time
+			AttStatus&		attStatus,		///< Orientation of antenna
+			VectorEcef		e,				///< Line of sight vector
+			double*			az_ptr,			///< Optional pointer to output antenna frame azimuth in degrees
+			double*			zen_ptr,		///< Optional pointer to output antenna frame zenith in degrees
+	const	AntennaHandle*	handle_ptr)		///< Optional previously resolved antenna entries
 {
 	// Rotate relative look vector into local frame
 	Matrix3d ant2Ecef = rotBasisMat(attStatus.eXAnt, attStatus.eYAnt, attStatus.eZAnt);
@@ -324,14 +371,29 @@ double antPcv(
 	if (az_ptr)			*az_ptr		= az;
 	if (zen_ptr)		*zen_ptr	= zen;
 
-	auto it0 = nav.pcvMap.find(id);
-	if (it0 == nav.pcvMap.end())
+	PcvSysFreqMap* pcvSysFreqMap_ptr = nullptr;
+
+	if	(  handle_ptr
+		&& handle_ptr->id == id)
+	{
+		pcvSysFreqMap_ptr = handle_ptr->pcvSysFreqMap_ptr;
+	}
+	else
+	{
+		auto it0 = nav.pcvMap.find(id);
+		if (it0 != nav.pcvMap.end())
+		{
+			pcvSysFreqMap_ptr = &it0->second;
+		}
+	}
+
+	if (pcvSysFreqMap_ptr == nullptr)
 	{
 		BOOST_LOG_TRIVIAL(warning) << "Warning: No PCV found for '" << id << "'";
 		return 0;
 	}
 
-	auto& [dummy0, pcvSysFreqMap] = *it0;
+	auto& pcvSysFreqMap = *pcvSysFreqMap_ptr;
 
 	auto it1 = pcvSysFreqMap.find(sys);
 	if (it1 == pcvSysFreqMap.end())
@@ -360,24 +422,16 @@ double antPcv(
 
 	auto& [dummy3, pcd] = *it3;
 
-	auto& pcvMap1D = pcd.elMap;
-	auto& pcvMap2D = pcd.azElMap;
-
 	int		nz		= pcd.nz;
 	int		naz		= pcd.naz;
 	double	zen1	= pcd.zenStart;
 	double	dzen	= pcd.zenDelta;
 	double	dazi	= pcd.aziDelta;
 
-	/* select zenith angle range */
-	int zen_n;
-	for (zen_n = 1; zen_n < nz - 1; zen_n++)
-	{
-		if ((zen1 + dzen * zen_n) >= zen)
-		{
-			break;
-		}
-	}
+	/* select zenith angle range, the first node at or above the zenith angle */
+	int zen_n = ceil((zen - zen1) / dzen);
+	if (zen_n > nz - 1)		zen_n = nz - 1;
+	if (zen_n < 1)			zen_n = 1;
 
 	double xz1 = zen1 + dzen * (zen_n - 1);
 	double xz2 = zen1 + dzen * (zen_n);
@@ -386,37 +440,32 @@ double antPcv(
 	double	pcv;
 
 	if	( naz	== 0
-		||az	== 0)
+		||az	== 0
+		||pcd.azElGrid.empty())
 	{
 		// linear interpolate receiver pcv - non azimuth-dependent
 
-		double	yz1 = pcvMap1D[zen_n - 1];		// lower bound
-		double	yz2 = pcvMap1D[zen_n];			// upper bound
+		double	yz1 = pcd.elMap[zen_n - 1];		// lower bound
+		double	yz2 = pcd.elMap[zen_n];			// upper bound
 		pcv = interp(xz1, xz2, yz1, yz2, zen);
 	}
 	else
 	{
 		// bilinear interpolate receiver pcv - azimuth-dependent
 
-		// select azimuth angle range */
-		int az_n;
-		for (az_n = 1; az_n < naz; az_n++)
-		{
-			if ((dazi * az_n) >= az)
-			{
-				break;
-			}
-		}
-		if (az_n == naz)
-		{
-			az_n = 0;
-		}
+		// select azimuth angle range, the first node at or above the azimuth
+		int az_n = ceil(az / dazi);
+		if (az_n > naz - 1)		az_n = naz - 1;
+		if (az_n < 1)			az_n = 1;
 
 		double xa1 = dazi * (az_n -1);
 		double xa2 = dazi * (az_n);
 
-		double yz3 = pcvMap2D[az_n-1]	[zen_n-1];		double yz1 = pcvMap2D[az_n-1]	[zen_n];
-		double yz4 = pcvMap2D[az_n]		[zen_n-1];		double yz2 = pcvMap2D[az_n]		[zen_n];
+		const double* row1 = &pcd.azElGrid[(az_n - 1)	* nz];
+		const double* row2 = &pcd.azElGrid[(az_n)		* nz];
+
+		double yz3 = row1[zen_n-1];		double yz1 = row1[zen_n];
+		double yz4 = row2[zen_n-1];		double yz2 = row2[zen_n];
 
 		// linear interpolation along zenith angle
 		double ya1	= interp(xz1, xz2, yz3, yz1, zen);
@@ -700,6 +749,20 @@ void readantexf(
 		{
 			noazi_flag	= false;
 
+			//flatten the azimuth dependent values so they may be interpolated by index
+			freqPcv.azElGrid.assign(freqPcv.naz * freqPcv.nz, 0);
+			for (auto& [az_n, elMap] : freqPcv.azElMap)
+			for (int zen_n = 0; zen_n < elMap.size() && zen_n < freqPcv.nz; zen_n++)
+			{
+				if	(  az_n < 0
+					|| az_n >= freqPcv.naz)
+				{
+					break;
+				}
+
+				freqPcv.azElGrid[az_n * freqPcv.nz + zen_n] = elMap[zen_n];
+			}
+
 			nav.pcvMap[id][sys][ft][time]			= freqPcv;
 			nav.pcoMap[id][sys][ft][time].recPco	= recPco;
 			nav.pcoMap[id][sys][ft][time].satPco	= satPco;
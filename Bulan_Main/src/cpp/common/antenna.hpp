@@ -29,6 +29,8 @@ struct PhaseCenterData : AzElMapData<double>
 
 	double tf[6];					///< valid from YMDHMS
 	double tu[6];					///< valid until YMDHMS
+
+	vector<double>	azElGrid;		///< azElMap flattened into a contiguous grid, as azElGrid[az_n * nz + zen_n]
 };
 
 struct PhaseCenterOffset
@@ -37,6 +39,18 @@ struct PhaseCenterOffset
 	Vector3d	recPco = Vector3d::Zero();
 };
 
+typedef map<E_Sys, map<E_FType, map<GTime, PhaseCenterOffset,	std::greater<GTime>>>>	PcoSysFreqMap;
+typedef map<E_Sys, map<E_FType, map<GTime, PhaseCenterData,	std::greater<GTime>>>>	PcvSysFreqMap;
+
+/** Antenna entries found in the pco and pcv maps, so that they need not be searched by name for every signal
+*/
+struct AntennaHandle
+{
+	string			id;								///< Antenna id that the handle was resolved for
+	PcoSysFreqMap*	pcoSysFreqMap_ptr	= nullptr;
+	PcvSysFreqMap*	pcvSysFreqMap_ptr	= nullptr;
+};
+
 //forward declaration for pointer below
 struct SatSys;
 struct AttStatus;
@@ -50,23 +64,29 @@ VectorEcef satAntOff(
 	map<int, double>&	lamMap);
 
 Vector3d antPco(
-	string		id,
-	E_Sys		sys,
-	E_FType		ft,
-	GTime		time,
-	double&		var,
-	E_Radio		radio,
-	bool		interp = false);
+	const	string&			id,
+			E_Sys			sys,
+			E_FType			ft,
+			GTime			time,
+			double&			var,
+			E_Radio			radio,
+			bool			interp		= false,
+	const	AntennaHandle*	handle_ptr	= nullptr);
 
 double antPcv(
-	string		id,
-	E_Sys		sys,
-	E_FType		ft,
-	GTime		time,
-	AttStatus&	attStatus,
-	VectorEcef	e,
-	double*		az_ptr	= nullptr,
-	double*		zen_ptr	= nullptr);
+	const	string&			id,
+			E_Sys			sys,
+			E_FType			ft,
+			GTime			time,
+			AttStatus&		attStatus,
+			VectorEcef		e,
+			double*			az_ptr		= nullptr,
+			double*			zen_ptr		= nullptr,
+	const	AntennaHandle*	handle_ptr	= nullptr);
+
+void resolveAntennaHandle(
+			AntennaHandle&	handle,
+	const	string&			id);
 
 bool findAntenna(
 	string				code,
@@ -427,19 +427,46 @@ GTime findEclipseBoundaries(
 	}
 	else // findEclipseBoundaries() usually gets called v. near to the start of the eclipse
 	{
-		while (inEclipse(rSat, rSun, rMoon))
-		{
-			dt -= precision;
+		double start	= 0;
+		double interval	= 60;
+		double end		= 0;
 
+		auto inEclipseAt = [&](double t)
+		{
 			SatPos satPos;
 			satPos.Sat = satGeom.Sat;
 
-			propagateEllipse(nullStream, time, dt, rSatEci0, vSatEci0, satPos);
+			propagateEllipse(nullStream, time, t, rSatEci0, vSatEci0, satPos);
 
-			rSat = satPos.rSatCom;
+			VectorEcef rSatT = satPos.rSatCom;
+			VectorEcef rSunT;
+			VectorEcef rMoonT;
+
+			sunMoonPos(time + t, rSunT, rMoonT);
+
+			return inEclipse(rSatT, rSunT, rMoonT);
+		};
+
+		// Step back by a minute at a time until outside the eclipse
+		bool eclipsed = inEclipse(rSat, rSun, rMoon);
+		while (eclipsed)
+		{
+			start	= end;
+			end		-= interval;
+
+			eclipsed = inEclipseAt(end);
+		}
+
+		// Binary search to the last whole second before the eclipse
+		while (start - end > precision)
+		{
+			double mid = end + floor((start - end) / precision / 2) * precision;
 
-			sunMoonPos(time + dt, rSun, rMoon);
+			if (inEclipseAt(mid))		start	= mid;
+			else						end		= mid;
 		}
+
+		dt = end;
 	}
 
 	return time + dt;
@@ -1217,14 +1244,7 @@ void updateSatYaw(
 	auto&	time			= satPos.posTime;
 	SatGeom	satGeom			= satOrbitGeometry(satPos);
 
-	string	blockTypeStr	= Sat.blockType();
-	std::replace(blockTypeStr.begin(), blockTypeStr.end(), '-', '_');
-	std::replace(blockTypeStr.begin(), blockTypeStr.end(), '+', 'P');
-	E_Block	blockType		= E_Block::UNKNOWN;
-	if (E_Block::_is_valid(blockTypeStr.c_str()))
-		blockType			= E_Block::_from_string_nocase(blockTypeStr.c_str());
-
-	switch (blockType)
+	switch (Sat.blockEnum())
 	{
 		case E_Block::GPS_I:		// Unmodelled
 		case E_Block::GPS_II:
@@ -0,0 +1,187 @@
+
+// #pragma GCC optimize ("O0")
+
+#include <fstream>
+#include <cstdlib>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <new>
+#include <map>
+
+using std::map;
+
+#include <boost/log/trivial.hpp>
+
+#include "benchmark.hpp"
+
+#ifdef ENABLE_BENCHMARK
+
+/** Accumulated statistics of a single processing stage
+ */
+struct BenchmarkStage
+{
+	double		seconds		= 0;	///< Total wall time spent in the stage, summed over threads
+	long int	calls		= 0;	///< Number of times the stage was entered
+	long int	allocations	= 0;	///< Number of c++ new allocations made within the stage
+};
+
+std::atomic<long int>	totalAllocations		= 0;
+std::atomic<long int>	totalAllocatedBytes		= 0;
+thread_local long int	threadAllocations		= 0;
+
+std::mutex						benchmarkMutex;
+map<string, BenchmarkStage>		benchmarkStageMap;
+
+std::chrono::steady_clock::time_point benchmarkStartTime = std::chrono::steady_clock::now();
+
+/** Count allocations made through c++ new, so that stages can report how many they make.
+ * Allocations made directly with malloc, including those of Eigen matrices, are not counted
+ */
+void* operator new(
+	size_t size)
+{
+	threadAllocations++;
+	totalAllocations++;
+	totalAllocatedBytes += size;
+
+	void* ptr = malloc(size);
+	if (ptr == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+
+	return ptr;
+}
+
+/** Count allocations made through c++ new for over-aligned types
+ */
+void* operator new(
+	size_t				size,
+	std::align_val_t	alignment)
+{
+	threadAllocations++;
+	totalAllocations++;
+	totalAllocatedBytes += size;
+
+	size_t align = static_cast<size_t>(alignment);
+
+	//aligned_alloc requires the size to be a multiple of the alignment
+	void* ptr = aligned_alloc(align, (size + align - 1) / align * align);
+	if (ptr == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+
+	return ptr;
+}
+
+void operator delete(
+	void* ptr)
+noexcept
+{
+	free(ptr);
+}
+
+void operator delete(
+	void*	ptr,
+	size_t	size)
+noexcept
+{
+	free(ptr);
+}
+
+void operator delete(
+	void*				ptr,
+	std::align_val_t	alignment)
+noexcept
+{
+	free(ptr);
+}
+
+void operator delete(
+	void*				ptr,
+	size_t				size,
+	std::align_val_t	alignment)
+noexcept
+{
+	free(ptr);
+}
+
+BenchmarkTimer::BenchmarkTimer(
+	const char* stage)
+:	stage				{stage},
+	startTime			{std::chrono::steady_clock::now()},
+	startAllocations	{threadAllocations}
+{
+
+}
+
+BenchmarkTimer::~BenchmarkTimer()
+{
+	auto stopTime = std::chrono::steady_clock::now();
+
+	double		seconds		= std::chrono::duration<double>(stopTime - startTime).count();
+	long int	allocations	= threadAllocations - startAllocations;
+
+	std::lock_guard<std::mutex> guard(benchmarkMutex);
+
+	auto& benchmarkStage = benchmarkStageMap[stage];
+
+	benchmarkStage.seconds		+= seconds;
+	benchmarkStage.calls		++;
+	benchmarkStage.allocations	+= allocations;
+}
+
+#endif
+
+/** Write the accumulated stage statistics to a json file that may be compared between builds
+ */
+void outputBenchmark(
+	const string&	filename,	///< File to write statistics to
+	int				epochs)		///< Number of epochs processed
+{
+#ifdef ENABLE_BENCHMARK
+	double totalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - benchmarkStartTime).count();
+
+	std::ofstream output(filename);
+	if (!output)
+	{
+		BOOST_LOG_TRIVIAL(error)
+		<< "Error: Could not open benchmark file " << filename;
+
+		return;
+	}
+
+	output << "{\n";
+	output << "\t\"epochs\": "				<< epochs										<< ",\n";
+	output << "\t\"seconds\": "				<< totalSeconds									<< ",\n";
+	output << "\t\"epochs_per_second\": "	<< (totalSeconds > 0 ? epochs / totalSeconds : 0)	<< ",\n";
+	output << "\t\"new_allocations\": "		<< totalAllocations								<< ",\n";
+	output << "\t\"new_allocated_bytes\": "	<< totalAllocatedBytes							<< ",\n";
+	output << "\t\"stages\": {";
+
+	std::lock_guard<std::mutex> guard(benchmarkMutex);
+
+	bool first = true;
+	for (auto& [stage, benchmarkStage] : benchmarkStageMap)
+	{
+		if (first == false)
+			output << ",";
+
+		first = false;
+
+		output << "\n";
+		output << "\t\t\"" << stage << "\": {"
+				<< "\"seconds\": "		<< benchmarkStage.seconds		<< ", "
+				<< "\"calls\": "		<< benchmarkStage.calls			<< ", "
+				<< "\"new_allocations\": "	<< benchmarkStage.allocations	<< "}";
+	}
+
+	output << "\n\t}\n";
+	output << "}\n";
+
+	BOOST_LOG_TRIVIAL(info)
+	<< "Benchmark results written to " << filename;
+#endif
+}
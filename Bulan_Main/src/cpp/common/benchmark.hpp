@@ -0,0 +1,37 @@
+
+#pragma once
+
+#include <string>
+#include <chrono>
+
+using std::string;
+
+/** Accumulates the wall time and c++ new allocations of a named processing stage while in scope.
+ * Allocations made directly with malloc, such as those of Eigen matrices, are not included.
+ *
+ * Statistics are only collected by builds with ENABLE_BENCHMARK defined (the pea_bench target), other builds compile this to nothing.
+ * Stages that run on several threads accumulate the time of each thread separately.
+ */
+struct BenchmarkTimer
+{
+#ifdef ENABLE_BENCHMARK
+	const char*								stage;				///< Name of the stage being timed
+	std::chrono::steady_clock::time_point	startTime;			///< Time at which the timer came into scope
+	long int								startAllocations;	///< New allocations made by this thread before the timer came into scope
+
+	BenchmarkTimer(
+		const char* stage);
+
+	~BenchmarkTimer();
+#else
+	BenchmarkTimer(
+		const char* stage)
+	{
+
+	}
+#endif
+};
+
+void outputBenchmark(
+	const string&	filename,
+	int				epochs);
@@ -8,7 +8,15 @@ FileType BSX__()
 
 }
 
+#include <shared_mutex>
 #include <functional>
+#include <mutex>
+#include <tuple>
+
+using std::shared_lock;
+using std::unique_lock;
+using std::shared_mutex;
+using std::tuple;
 
 #include "constants.hpp"
 #include "acsConfig.hpp"
@@ -18,6 +26,29 @@ FileType BSX__()
 
 BiasMap biasMaps;		///< Multi dimensional map, as biasMaps[measType][id][code1][code2][time]
 
+/** Result of a (possibly chained) bias search, kept so that repeated searches at the same time need not traverse the bias graph again
+*/
+struct ResolvedBias
+{
+	GTime		time;				///< Time that the search was performed for
+	bool		found = false;		///< Whether a path between the codes was found
+	BiasEntry	entry;				///< The combined bias entry along the path found
+};
+
+typedef tuple<int, string, int, int>	ResolvedBiasKey;		///< Key of a resolved bias, as (measType, id, code1, code2)
+
+map<ResolvedBiasKey, ResolvedBias>	resolvedBiasMap;			///< Resolved bias searches, cleared whenever biasMaps changes
+shared_mutex						resolvedBiasMutex;
+
+/** Forget all resolved bias searches, must be called whenever the contents of biasMaps change
+*/
+void clearResolvedBiases()
+{
+	unique_lock<shared_mutex> guard(resolvedBiasMutex);
+
+	resolvedBiasMap.clear();
+}
+
 
 /** Initialise satellite DSBs between default signals, e.g. P1-P2 DCBs, with 0 values
 */
@@ -123,6 +154,8 @@ void pushBiasEntry(
 	string		id,			///< Device ID
 	BiasEntry	entry)		///< Bias entry to push into biasMaps
 {
+	clearResolvedBiases();
+
 	//add forward bias to maps
 	biasMaps	[entry.measType]
 				[id]
@@ -152,6 +185,8 @@ void pushBiasEntry(
 void cullOldBiases(
 	GTime time)
 {
+	clearResolvedBiases();
+
 	for (auto& typeBiasMap				: biasMaps)
 	for (auto& [dummy1, idBiasMap]		: typeBiasMap)
 	for (auto& [dummy2, code1BiasMap]	: idBiasMap)
@@ -498,6 +533,8 @@ bool biasRecurser(
 }
 
 /** Search for hardware bias for given measurmenet type
+ * Results (including failed searches) are remembered per epoch, so that biases shared between receivers, e.g. satellite biases,
+ * are only chained through the bias graph once per epoch rather than once per receiver.
 */
 bool getBiasEntry(
 			Trace&		trace,				///< Trace to output to
@@ -508,21 +545,49 @@ bool getBiasEntry(
 			E_ObsCode	obsCode1,			///< Base code of observation to find biases for
 			E_ObsCode	obsCode2)			///< Secondary code of observation to find biases for
 {
-	//get the basic map of biases for this ID and measurmenet type
-	try
+	ResolvedBiasKey key = {measType, id, obsCode1, obsCode2};
+
 	{
-		auto& biasMap = biasMaps[measType].at(id);
+		shared_lock<shared_mutex> guard(resolvedBiasMutex);
 
-		set<E_ObsCode> checkedObscodes;
+		auto it = resolvedBiasMap.find(key);
+		if	(  it != resolvedBiasMap.end()
+			&& it->second.time == time)
+		{
+			auto& resolved = it->second;
 
-		bool pass = biasRecurser(trace, time, output, obsCode1, obsCode2, biasMap, checkedObscodes);
+			if (resolved.found)
+				output = resolved.entry;
 
-		return pass;
+			return resolved.found;
+		}
 	}
-	catch (...)
+
+	//get the basic map of biases for this ID and measurmenet type
+	ResolvedBias resolved;
+	resolved.time = time;
+
+	auto& idBiasMap = biasMaps[measType];
+
+	auto it = idBiasMap.find(id);
+	if (it != idBiasMap.end())
 	{
-		return false;
+		auto& [dummy, biasMap] = *it;
+
+		set<E_ObsCode> checkedObscodes;
+
+		resolved.found = biasRecurser(trace, time, resolved.entry, obsCode1, obsCode2, biasMap, checkedObscodes);
 	}
+
+	bool pass = resolved.found;
+	if (pass)
+		output = resolved.entry;
+
+	unique_lock<shared_mutex> guard(resolvedBiasMutex);
+
+	resolvedBiasMap[key] = std::move(resolved);
+
+	return pass;
 }
 
 /** Search for hardware biases in phase and code
@@ -1,4 +1,7 @@
 
+#include <algorithm>
+#include <memory>
+
 #include "eigenIncluder.hpp"
 #include "observations.hpp"
 #include "navigation.hpp"
@@ -16,6 +19,7 @@
 
 #define ERREPH_GLO		5.0					///< error of glonass ephemeris (m)
 #define TSTEP			60.0				///< integration step glonass ephemeris (s)
+#define GLO_ORBIT_NODES	((int) (MAXDTOE_GLO / TSTEP) + 1)	///< number of cached integration nodes either side of glonass toe
 #define RTOL_KEPLER		1E-14				///< relative tolerance for Kepler equation
 
 #define MAX_ITER_KEPLER	30					///< max number of iteration of Kelpler
@@ -367,8 +371,58 @@ void eph2Pos(
 }
 
 
+/** glonass orbit states integrated from toe at every TSTEP across the validity window of the ephemeris.
+* The nodes are integrated once per ephemeris and shared by all copies of it, a replaced ephemeris starts with no nodes.
+* Concurrent first calls may both integrate, the first to publish its nodes wins and the others use the stored nodes.
+* The nodes are returned by shared pointer so that callers keep them alive while they are in use.
+*/
+shared_ptr<const vector<array<double, 6>>> gephOrbitNodes(
+	Geph&		geph)			///< glonass ephemeris
+{
+	auto nodes_ptr = std::atomic_load(&geph.orbitNodes_ptr);
+	if (nodes_ptr)
+	{
+		return nodes_ptr;
+	}
+
+	int nodeCount = GLO_ORBIT_NODES;
+
+	auto newNodes_ptr = std::make_shared<vector<array<double, 6>>>(2 * nodeCount + 1);
+	auto& newNodes = *newNodes_ptr;
+
+	for (int dir : {-1, +1})
+	{
+		double x[6];
+		for (int i = 0; i < 3; i++)
+		{
+			x[i    ] = geph.pos[i];
+			x[i + 3] = geph.vel[i];
+		}
+
+		std::copy(x, x + 6, newNodes[nodeCount].begin());
+
+		for (int k = 1; k <= nodeCount; k++)
+		{
+			glorbit(dir * TSTEP, x, geph.acc);
+
+			std::copy(x, x + 6, newNodes[nodeCount + dir * k].begin());
+		}
+	}
+
+	shared_ptr<const vector<array<double, 6>>> published_ptr = newNodes_ptr;
+
+	if (std::atomic_compare_exchange_strong(&geph.orbitNodes_ptr, &nodes_ptr, published_ptr) == false)
+	{
+		//another thread published first, nodes_ptr has been updated to its nodes
+		return nodes_ptr;
+	}
+
+	return published_ptr;
+}
+
 /** glonass ephemeris to satellite position and clock bias.
 * compute satellite position and clock bias with glonass ephemeris
+* integration starts from the last cached node before the requested time, which is equivalent to integrating from toe
 */
 void eph2Pos(
 	GTime		time,			///< time (gpst)
@@ -380,12 +434,19 @@ void eph2Pos(
 
 	double t = (time - geph.toe).to_double();
 
+	auto	nodes_ptr	= gephOrbitNodes(geph);
+	auto&	nodes		= *nodes_ptr;
+
+	int nodeCount	= GLO_ORBIT_NODES;
+	int k			= (int) (t / TSTEP);
+
+	if (k >  nodeCount)		k =  nodeCount;
+	if (k < -nodeCount)		k = -nodeCount;
+
+	t -= k * TSTEP;
+
 	double x[6];
-	for (int i = 0; i < 3; i++)
-	{
-		x[i    ] = geph.pos[i];
-		x[i + 3] = geph.vel[i];
-	}
+	std::copy(nodes[nodeCount + k].begin(), nodes[nodeCount + k].end(), x);
 
 	for (double tt = t < 0 ? -TSTEP : TSTEP; fabs(t) > 1E-9; t -= tt)
 	{
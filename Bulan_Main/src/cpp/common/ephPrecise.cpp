@@ -20,6 +20,7 @@ using std::map;
 #include "ephPrecise.hpp"
 #include "constants.hpp"
 #include "mongoRead.hpp"
+#include "acsConfig.hpp"
 #include "ephemeris.hpp"
 #include "receiver.hpp"
 #include "algebra.hpp"
@@ -35,6 +36,10 @@ using std::map;
 #define EXTERR_CLK	1E-3			/* extrapolation error for clock (m/s) */
 #define EXTERR_EPH	5E-7			/* extrapolation error for ephem (m/s^2) */
 
+#define ARC_STEP	1.0				/* spacing of precise arc nodes (s) */
+#define ARC_BEFORE	2.0				/* duration of precise arc before epoch, covers transmission times (s) */
+#define ARC_AFTER	1.0				/* duration of precise arc after epoch (s) */
+
 /** read dcb parameters file
 */
 int readdcb(
@@ -492,12 +497,128 @@ bool satPosPrecise(
 	return true;
 }
 
+/** Evaluate a precise arc at a time within its span, using cubic hermite interpolation between the neighbouring nodes
+*/
+bool preciseArcPos(
+	PreciseArc&	arc,
+	GTime		time,
+	Vector3d&	rSat,
+	Vector3d&	satVel,
+	double&		ephVar)
+{
+	if (arc.posList.size() < 2)
+	{
+		return false;
+	}
+
+	double	h = arc.step;
+	double	t = (time - arc.time0).to_double();
+	int		i = (int) floor(t / h);
+
+	if	( i < 0
+		||i >= arc.posList.size() - 1)
+	{
+		return false;
+	}
+
+	double s	= t / h - i;
+	double s2	= s * s;
+	double s3	= s * s2;
+
+	auto& p0 = arc.posList[i];		auto& v0 = arc.velList[i];
+	auto& p1 = arc.posList[i + 1];	auto& v1 = arc.velList[i + 1];
+
+	rSat	= ( 2 * s3 - 3 * s2 + 1)		* p0
+			+ (     s3 - 2 * s2 + s)	* h	* v0
+			+ (-2 * s3 + 3 * s2)			* p1
+			+ (     s3 -     s2)		* h	* v1;
+
+	satVel	= ( 6 * s2 - 6 * s)			/ h	* p0
+			+ ( 3 * s2 - 4 * s + 1)			* v0
+			+ (-6 * s2 + 6 * s)			/ h	* p1
+			+ ( 3 * s2 - 2 * s)				* v1;
+
+	if (s < 0.5)	ephVar = arc.varList[i];
+	else			ephVar = arc.varList[i + 1];
+
+	return true;
+}
+
+/** Precompute short arcs of precise satellite states about an epoch.
+* Receivers request positions at nearly identical transmission times within an epoch,
+* these are evaluated from the arc rather than re-interpolating the precise ephemerides for every receiver.
+* Requests outside the arc, or for systems that are not processed, fall back to direct interpolation.
+*/
+void updatePreciseArcs(
+	Trace&		trace,
+	GTime		time,
+	Navigation&	nav)
+{
+	int nodes = (int) round((ARC_BEFORE + ARC_AFTER) / ARC_STEP) + 1;
+
+	for (auto& [Sat, satNav] : nav.satNavMap)
+	{
+		auto& arc = satNav.preciseArc;
+
+		arc = {};
+
+		if (acsConfig.process_sys[Sat.sys] == false)
+		{
+			continue;
+		}
+
+		if (nav.pephMap.find(Sat.id()) == nav.pephMap.end())
+		{
+			continue;
+		}
+
+		arc.time0	= time - ARC_BEFORE;
+		arc.step	= ARC_STEP;
+
+		arc.posList.resize(nodes);
+		arc.velList.resize(nodes);
+		arc.varList.resize(nodes);
+
+		SatSys satId = Sat;
+
+		for (int i = 0; i < nodes; i++)
+		{
+			bool pass = satPosPrecise(trace, arc.time0 + i * ARC_STEP, satId, arc.posList[i], arc.velList[i], arc.varList[i], nav);
+			if (pass == false)
+			{
+				arc = {};
+				break;
+			}
+		}
+	}
+}
+
+/** Remove precise arcs so that all requests are interpolated directly, eg. when revisiting previous epochs
+*/
+void clearPreciseArcs(
+	Navigation&	nav)
+{
+	for (auto& [Sat, satNav] : nav.satNavMap)
+	{
+		satNav.preciseArc = {};
+	}
+}
+
 bool satPosPrecise(
 	Trace&		trace,
 	GTime		time,
 	SatPos&		satPos,
 	Navigation&	nav)
 {
+	if (satPos.satNav_ptr)
+	{
+		bool pass = preciseArcPos(satPos.satNav_ptr->preciseArc, time, satPos.rSatCom, satPos.satVel, satPos.posVar);
+		if (pass)
+		{
+			return true;
+		}
+	}
+
 	return satPosPrecise(
 		trace,
 		time,
@@ -12,12 +12,16 @@
 
 
 #include <iostream>
+#include <memory>
 #include <string>
 #include <vector>
+#include <array>
 #include <map>
 
+using std::shared_ptr;
 using std::string;
 using std::vector;
+using std::array;
 using std::map;
 
 
@@ -189,6 +193,8 @@ struct Geph : BrdcEph
 	int		NT;				///< calender number of day within 4-year interval
 	bool	moreData;		///< availability of additional data
 	int		N4;				///< 4-year interval number
+
+	shared_ptr<const vector<array<double, 6>>>	orbitNodes_ptr;	///< integrated states at integration steps either side of toe, computed on first use and shared between copies
 };
 
 /** precise clock
@@ -510,6 +516,14 @@ bool satClkPrecise(
 	SatPos&			satPos,
 	Navigation&		nav);
 
+void updatePreciseArcs(
+	Trace&			trace,
+	GTime			time,
+	Navigation&		nav);
+
+void clearPreciseArcs(
+	Navigation&		nav);
+
 
 bool satPosSSR(
 	Trace&			trace,
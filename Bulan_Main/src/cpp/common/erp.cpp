@@ -7,8 +7,10 @@
 #include <fstream>
 #include <string>
 #include <chrono>
+#include <array>
 
 using std::chrono::system_clock;
+using std::array;
 using std::stringstream;
 using std::string;
 
@@ -324,30 +326,36 @@ void readIersBulletinA(
 	}
 }
 
-/** Get earth rotation parameter values
- */
-ERPValues getErp(
-	ERP&		erp,		///< earth rotation parameters
-	GTime		time,		///< Time
-	bool		useFilter)	///< Optionally use the filter values stored in the erp object
+/** Add a map of erp values to the erp object, warning of any gaps that are too large to interpolate across
+*/
+void addErpMap(
+	ERP&					erp,		///< earth rotation parameters
+	map<GTime, ERPValues>&	erpMap)		///< Map of values to add
 {
-	if	( useFilter
-		&&erp.filterValues.isFiltered)
+	GTime lastTime;
+	for (auto& [time, erpv] : erpMap)
 	{
-		ERPValues erpv = erp.filterValues;
-
-		double dt = (time - erpv.time).to_double() / S_IN_DAY;
-		if (dt)
+		if	( lastTime > GTime::noTime()
+			&&(time - lastTime).to_double() > 2 * S_IN_DAY)
 		{
-			erpv.time	+= dt;
-			erpv.xp		+= erpv.xpr * dt;
-			erpv.yp		+= erpv.ypr * dt;
-			erpv.ut1Utc	-= erpv.lod * dt;
+			BOOST_LOG_TRIVIAL(warning) << "Warning: Gap in ERP values between " << lastTime.to_string() << " and " << time.to_string() << ", other sources will be used if available.";
+
+			break;
 		}
 
-		return erpv;
+		lastTime = time;
 	}
 
+	erp.erpMaps.push_back(erpMap);
+	erp.version++;
+}
+
+/** Interpolate erp values from the maps in the erp object
+*/
+ERPValues interpolateErp(
+	ERP&		erp,		///< earth rotation parameters
+	GTime		time)		///< Time
+{
 	ERPValues erpv;
 
 	auto& recOpts = acsConfig.getRecOpts("global");
@@ -458,6 +466,63 @@ ERPValues getErp(
 	return erpv;
 }
 
+/** Get erp values at a time, from the filter if available, or interpolated from the loaded erp maps.
+* Interpolated values are requested many times for the same epochs, so recent results are kept per thread until the erp maps change
+*/
+ERPValues getErp(
+	ERP&		erp,		///< earth rotation parameters
+	GTime		time,		///< Time
+	bool		useFilter)	///< Optionally use the filter values stored in the erp object
+{
+	if	( useFilter
+		&&erp.filterValues.isFiltered)
+	{
+		ERPValues erpv = erp.filterValues;
+
+		double dt = (time - erpv.time).to_double() / S_IN_DAY;
+		if (dt)
+		{
+			erpv.time	+= dt;
+			erpv.xp		+= erpv.xpr * dt;
+			erpv.yp		+= erpv.ypr * dt;
+			erpv.ut1Utc	-= erpv.lod * dt;
+		}
+
+		return erpv;
+	}
+
+	struct ErpCacheEntry
+	{
+		const ERP*	erpPtr	= nullptr;
+		int			version	= -1;
+		GTime		time;
+		ERPValues	erpv;
+	};
+
+	thread_local array<ErpCacheEntry, 8>	erpCache;
+	thread_local int						erpCacheNext = 0;
+
+	for (auto& entry : erpCache)
+	{
+		if	( entry.erpPtr	== &erp
+			&&entry.version	== erp.version
+			&&entry.time	== time)
+		{
+			return entry.erpv;
+		}
+	}
+
+	auto& entry = erpCache[erpCacheNext];
+	erpCacheNext = (erpCacheNext + 1) % erpCache.size();
+
+	entry.erpPtr	= &erp;
+	entry.version	= erp.version;
+	entry.time		= time;
+	entry.erpv		= interpolateErp(erp, time);
+
+	return entry.erpv;
+}
+
 void writeErp(
 	string		filename,
 	ERPValues&	erp)
@@ -606,7 +671,7 @@ void readErp(
 		else if	(  line.size()	<=  79)								readIersBulletinA	(line, erpMap);
 	}
 
-	erp.erpMaps.push_back(erpMap);
+	addErpMap(erp, erpMap);
 }
 
 Matrix3d stationEopPartials(
@@ -108,6 +108,8 @@ struct ERP
 	vector<map<GTime, ERPValues>>	erpMaps;
 
 	ERPValues						filterValues;
+
+	int								version	= 0;	///< Incremented whenever erpMaps change, invalidates values cached by getErp
 };
 
 struct KFState;
@@ -116,6 +118,10 @@ void readErp(
 	string		filename,
 	ERP&		erp);
 
+void addErpMap(
+	ERP&					erp,
+	map<GTime, ERPValues>&	erpMap);
+
 ERPValues getErp(
 	ERP&		erp,
 	GTime		time,
@@ -1,8 +1,12 @@
 
 // #pragma GCC optimize ("O0")
 
+#include <algorithm>
+#include <vector>
 #include <math.h>
 
+using std::vector;
+
 #include "observations.hpp"
 #include "navigation.hpp"
 #include "coordinates.hpp"
@@ -243,33 +247,71 @@ int interpTec(
 	return 1;
 }
 
-/** ionosphere delay by tec grid data
+/** Pierce points of a signal path through the layers of a tec grid, which are shared by all grids with the same layer geometry
  */
-bool ionDelay(
-	GTime				time,			///< Time
-	const TEC&			tec,			///< Input electron content data
+struct TecPiercePoints
+{
+	double				rb		= 0;	///< earth radius (km)
+	double				hgt0	= 0;	///< height of first layer (km)
+	double				hgtStep	= 0;	///< height interval between layers (km)
+	int					numHgt	= 0;	///< number of layers
+	double				fs		= 0;	///< mapping function value
+	vector<VectorPos>	posps;			///< pierce point positions for each layer
+};
+
+/** Compute pierce points through the layers of a tec grid, if they are not already valid for its geometry
+ */
+void tecPiercePoints(
+	const TEC&			tec,			///< Grid to compute pierce points for
 	const VectorPos&	pos,			///< Position of receiver
 	const AzEl&			azel,			///< Azimuth and elevation of signal path
 	E_IonoMapFn			mapFn,			///< model of mapping function
 	double				layerHeight,	///< Mapping function layer height
-	E_IonoFrame			frame,			///< reference frame
-	double&				delay,			///< Delay in meters
-	double&				var)			///< Variance
+	TecPiercePoints&	ipps)			///< Pierce points to update
 {
-	// if (fdebug)
-	// 	fprintf(fdebug, "%s: time=%s pos=%.1f %.1f azel=%.1f %.1f\n", __FUNCTION__, time.to_string(0).c_str(), pos[0]*R2D, pos[1]*R2D, azel[0]*R2D, azel[1]*R2D);
+	if	( ipps.numHgt	== tec.ndata[2]
+		&&ipps.rb		== tec.rb
+		&&ipps.hgt0		== tec.hgts[0]
+		&&ipps.hgtStep	== tec.hgts[2])
+	{
+		return;
+	}
 
-	delay	= 0;
-	var		= 0;
+	ipps.rb			= tec.rb;
+	ipps.hgt0		= tec.hgts[0];
+	ipps.hgtStep	= tec.hgts[2];
+	ipps.numHgt		= tec.ndata[2];
+	ipps.fs			= ionmapf(pos, azel, mapFn, layerHeight);
+
+	ipps.posps.resize(std::max(ipps.numHgt, 0));
 
-	for (int i = 0; i < tec.ndata[2]; i++)
+	for (int i = 0; i < ipps.numHgt; i++)
 	{
 		double hion = tec.hgts[0] + tec.hgts[2] * i;
 
 		/* ionospheric pierce point position */
-		VectorPos posp;
-		ionppp(pos, azel, tec.rb, hion, posp);
-		double fs = ionmapf(pos, azel, mapFn, layerHeight);
+		ionppp(pos, azel, tec.rb, hion, ipps.posps[i]);
+	}
+}
+
+/** ionosphere delay by tec grid data
+ */
+bool ionDelay(
+	GTime					time,			///< Time
+	const TEC&				tec,			///< Input electron content data
+	const TecPiercePoints&	ipps,			///< Pierce points of signal path through the grid layers
+	E_IonoFrame				frame,			///< reference frame
+	double&					delay,			///< Delay in meters
+	double&					var)			///< Variance
+{
+	delay	= 0;
+	var		= 0;
+
+	const double fact = TEC_CONSTANT / SQR(FREQ1); /* tecu->L1 iono (m) */
+
+	for (int i = 0; i < ipps.numHgt; i++)
+	{
+		VectorPos posp = ipps.posps[i];
 
 		if (frame == +E_IonoFrame::SUN_FIXED)
 		{
@@ -283,9 +325,8 @@ bool ionDelay(
 		if (interpTec(tec, i, posp, vtec, rms) == false)
 			return false;
 
-		const double fact = TEC_CONSTANT / SQR(FREQ1); /* tecu->L1 iono (m) */
-		delay	+= fact * fs * vtec;
-		var		+= SQR(fact * fs * rms);
+		delay	+= fact * ipps.fs * vtec;
+		var		+= SQR(fact * ipps.fs * rms);
 	}
 
 	tracepdeex(6,std::cout, "%s: delay=%7.2f std=%6.2f\n",__FUNCTION__, delay, sqrt(var));
@@ -334,8 +375,13 @@ bool iontec(
 	double dels[2];
 	double vars[2];
 
+	//pierce points depend only on the grid geometry, so are normally shared by both maps
+	thread_local TecPiercePoints ipps;
+	ipps.numHgt = -1;
+
 	auto& [t0, tec0] = *it;
-	pass[0] = ionDelay(time, tec0, pos, azel, mapFn, layerHeight, frame, dels[0], vars[0]);
+	tecPiercePoints(tec0, pos, azel, mapFn, layerHeight, ipps);
+	pass[0] = ionDelay(time, tec0, ipps, frame, dels[0], vars[0]);
 
 	if (it == nav->tecMap.begin())
 	{
@@ -348,7 +394,8 @@ bool iontec(
 	it--;
 
 	auto& [t1, tec1] = *it;
-	pass[1] = ionDelay(time, tec1, pos, azel, mapFn, layerHeight, frame, dels[1], vars[1]);
+	tecPiercePoints(tec1, pos, azel, mapFn, layerHeight, ipps);
+	pass[1] = ionDelay(time, tec1, ipps, frame, dels[1], vars[1]);
 
 
 	if	(  pass[0]
@@ -46,6 +46,17 @@ struct TEC
 	vector<TECPoint>	tecPointVector;
 };
 
+/** Short arc of precise satellite states about an epoch, shared by all receivers during that epoch
+ */
+struct PreciseArc
+{
+	GTime				time0;						///< Time of the first node
+	double				step			= 0;		///< Spacing between nodes (s)
+	vector<Vector3d>	posList;					///< Satellite positions at each node (ecef)
+	vector<Vector3d>	velList;					///< Satellite velocities at each node (ecef)
+	vector<double>		varList;					///< Satellite position variances at each node
+};
+
 struct SatNav
 {
 	map<int, double>	lamMap;
@@ -56,6 +67,7 @@ struct SatNav
 	double				aprioriClk		= 0;		///< Apriori clock value at epoch time
 
 	AttStatus			attStatus		= {};		///< Persistent data for attitude model
+	AntennaHandle		antennaHandle;				///< pco and pcv entries for this satellite
 
 	string				id;
 	string				traceFilename;
@@ -65,6 +77,7 @@ struct SatNav
 	Vector3d			antAzimuth		= {0,1,0};
 
 	SatPos				satPos0;					///< Satellite position when propagated to nominal time
+	PreciseArc			preciseArc;					///< Precise orbit nodes about the current epoch
 };
 
 /** navigation data type
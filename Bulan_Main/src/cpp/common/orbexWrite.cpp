@@ -240,11 +240,7 @@ void updateOrbexBody(
 {
 	GEpoch ep = time;
 
-	// first create if non existing
-	{
-		std::fstream maker(filename, std::ios::app);
-	}
-	std::fstream orbexStream(filename);
+	auto& orbexStream = getProductStream(filename, time);
 
 	if (!orbexStream)
 	{
@@ -336,6 +332,8 @@ void updateOrbexBody(
 			tracepdeex(0, orbexStream, " %3s\n", sat.id().c_str());
 		}
 	}
+
+	orbexStream.flush();
 }
 
 /** Retrieve satellite orbits, clocks and attitudes for all included systems and write out to an ORBEX file
@@ -0,0 +1,47 @@
+
+#pragma once
+
+#include <vector>
+
+using std::vector;
+
+#include "eigenIncluder.hpp"
+
+#ifdef ENABLE_PARALLELISATION
+	#include "omp.h"
+#endif
+
+/** Perform a function on each element of a container in parallel.
+ *
+ * Elements are indexed once before the loop, so each task reaches its element in constant time regardless of the container type.
+ * Tasks are handed out dynamically, so that elements with very different workloads (eg receivers with many or few observations) are balanced between threads.
+ * Eigen is limited to a single thread for the duration of the loop and restored afterwards.
+ */
+template<
+	typename CONTAINER,
+	typename FUNCTION>
+void parallelForEach(
+	CONTAINER&	container,		///< Container of elements to process, elements must not be added or removed by the function
+	FUNCTION	function)		///< Function to call with a reference to each element
+{
+	vector<typename CONTAINER::value_type*> elementList;
+	elementList.reserve(container.size());
+
+	for (auto& element : container)
+	{
+		elementList.push_back(&element);
+	}
+
+#	ifdef ENABLE_PARALLELISATION
+		int eigenThreads = Eigen::nbThreads();
+		Eigen::setNbThreads(1);
+#		pragma omp parallel for schedule(dynamic)
+#	endif
+	for (int i = 0; i < elementList.size(); i++)
+	{
+		function(*elementList[i]);
+	}
+#	ifdef ENABLE_PARALLELISATION
+		Eigen::setNbThreads(eigenThreads);
+#	endif
+}
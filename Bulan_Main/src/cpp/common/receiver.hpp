@@ -4,6 +4,7 @@
 #include "eigenIncluder.hpp"
 #include "observations.hpp"
 #include "attitude.hpp"
+#include "antenna.hpp"
 #include "satStat.hpp"
 #include "common.hpp"
 #include "cache.hpp"
@@ -69,12 +70,32 @@ struct TideMap : map<E_TidalConstituent, TidalDisplacement>
 
 };
 
+/** Tidal displacements of a single component evaluated at regularly spaced nodes, for interpolation to epoch times
+*/
+struct TideNodes
+{
+	VectorEcef			nodePos;		///< Receiver position that the node values were evaluated at
+	map<long, Vector3d>	nodeMap;		///< Displacements (ecef) indexed by node number since the start of GPS time
+};
+
+/** Node caches for each tidal component of a receiver
+*/
+struct TideNodeCache
+{
+	TideNodes	solid;
+	TideNodes	otl;
+	TideNodes	atl;
+	TideNodes	spole;
+	TideNodes	opole;
+};
+
 struct Rtk
 {
 	Solution					sol;								///< RTK solution
 	string						antennaType;
 	string						receiverType;
 	string						antennaId;
+	AntennaHandle				antennaHandle;						///< pco and pcv entries for antennaId
 	map<SatSys, SatStat>		satStatMap;
 	TideMap						otlDisplacement;					///< ocean tide loading parameters
 	TideMap						atlDisplacement;					///< atmospheric tide loading parameters
@@ -153,6 +174,7 @@ struct Receiver : ReceiverLogs, Rtk
 		};
 	};
 	Cache<tuple<Vector3d, Vector3d, Vector3d, Vector3d, Vector3d>>	pppTideCache;
+	TideNodeCache													tideNodeCache;		///< Tidal displacements at coarse time nodes, persists between epochs
 	Cache<tuple<Vector3d>>											pppEopCache;
 };
 
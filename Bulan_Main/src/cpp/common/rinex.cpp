@@ -823,8 +823,6 @@ int decodeObsData(
 		stat = 0;
 	}
 
-	auto& codeTypes = sysCodeTypes[obs.Sat.sys];
-
 	int j;
 	if (ver <= 2.99)	j = 0;
 	else				j = 3;
@@ -832,6 +830,18 @@ int decodeObsData(
 	if (!stat)
 		return 0;
 
+	//use lookups only, bodies may be decoded concurrently with other streams, so no maps may be inserted into here
+	auto codeTypesIt = sysCodeTypes.find(obs.Sat.sys);
+	if (codeTypesIt == sysCodeTypes.end())
+		return 1;
+
+	auto& codeTypes = codeTypesIt->second;
+
+	const map<E_ObsCode, E_FType>* sysFreqs_ptr = nullptr;
+	auto sysFreqsIt = code2Freq.find(obs.Sat.sys);
+	if (sysFreqsIt != code2Freq.end())
+		sysFreqs_ptr = &sysFreqsIt->second;
+
 	for (auto& [index, codeType] : codeTypes)
 	{
 		if	( ver	<= 2.99
@@ -844,7 +854,13 @@ int decodeObsData(
 			j = 0;
 		}
 
-		E_FType ft = code2Freq[obs.Sat.sys][codeType.code];
+		E_FType ft = FTYPE_NONE;
+		if (sysFreqs_ptr)
+		{
+			auto freqIt = sysFreqs_ptr->find(codeType.code);
+			if (freqIt != sysFreqs_ptr->end())
+				ft = freqIt->second;
+		}
 
 		RawSig* rawSig = nullptr;
 		auto& sigList = obs.sigsLists[ft];
@@ -1779,7 +1795,7 @@ int readRnxNav(
 		}
 
 		if (!erpMap.empty())
-			nav.erp.erpMaps.push_back(erpMap);
+			addErpMap(nav.erp, erpMap);
 	}
 
 	return	( nav. ephMap.empty() == false
@@ -48,7 +48,7 @@ void outputRinexClocksBody(
 	ClockList&		clkEntryList,	///< List of data to print.
 	const GTime&	time)		    ///< Epoch time.
 {
-	std::ofstream clockFile(filename, std::ofstream::app);
+	auto& clockFile = getProductStream(filename, time);
 
 	if (!clockFile)
 	{
@@ -56,6 +56,8 @@ void outputRinexClocksBody(
 		return;
 	}
 
+	clockFile.seekp(0, std::ios::end);
+
 	GEpoch ep = time;
 
 	for (auto& clkEntry : clkEntryList)
@@ -77,6 +79,8 @@ void outputRinexClocksBody(
 			clkEntry.clock,
 			clkEntry.sigma);
 	}
+
+	clockFile.flush();
 }
 
 void getKalmanSatClks(
@@ -260,7 +264,7 @@ void outputRinexClocksHeader(
 	map<E_Sys, bool>&	sysMap,				///< Options to enable outputting of specific systems
 	GTime				time)				///< Epoch time
 {
-	std::ofstream clockFile(filename, std::ofstream::app);
+	auto& clockFile = getProductStream(filename, time);
 
 	if (!clockFile)
 	{
@@ -268,6 +272,8 @@ void outputRinexClocksHeader(
 		return;
 	}
 
+	clockFile.seekp(0, std::ios::end);
+
 	auto pos = clockFile.tellp();
 	if (pos != 0)
 		return;
@@ -452,6 +458,60 @@ map<string, map<E_Sys, bool>> getSysOutputFilenames(
 	return fileOutputSysMap;
 }
 
+/** Output product file that is held open between epochs
+*/
+struct ProductStream
+{
+	std::fstream	stream;			///< Stream to the file, opened for reading and writing
+	GTime			lastTime;		///< Epoch that the file was last requested for
+};
+
+map<string, ProductStream> productStreamMap;
+
+/** Get a stream to an output product file, which is kept open between epochs rather than being reopened for every one.
+* The file is created if it doesn't exist. Streams for files that have not been requested within a rotation period are closed.
+*/
+std::fstream& getProductStream(
+	string	filename,		///< Path of file to get stream for
+	GTime	time)			///< Epoch that the file is being written for
+{
+	for (auto it = productStreamMap.begin(); it != productStreamMap.end(); )
+	{
+		auto& [name, product] = *it;
+
+		if	( name != filename
+			&&(time - product.lastTime).to_double() > acsConfig.rotate_period)
+		{
+			it = productStreamMap.erase(it);
+		}
+		else
+		{
+			it++;
+		}
+	}
+
+	auto& product = productStreamMap[filename];
+	product.lastTime = time;
+
+	if	( product.stream.is_open()
+		&&product.stream.good())
+	{
+		return product.stream;
+	}
+
+	product.stream.close();
+	product.stream.clear();
+
+	//first create if non existing
+	{
+		std::fstream maker(filename, std::ios::app);
+	}
+
+	product.stream.open(filename);
+
+	return product.stream;
+}
+
 void outputClocks(
 	string				filename,
 	const GTime&		time,
@@ -28,5 +28,9 @@ map<string, map<E_Sys, bool>> getSysOutputFilenames(
 	bool	replaceSys	= true,
 	string	id			= "");
 
+std::fstream& getProductStream(
+	string	filename,
+	GTime	time);
+
 extern map<string, string> rinexObsFilenameMap;
 
@@ -1,6 +1,8 @@
 
 // #pragma GCC optimize ("O0")
 
+#include <algorithm>
+
 #include "satSys.hpp"
 
 
@@ -27,6 +29,22 @@ vector<SatSys> getSysSats(
 	return sats;
 }
 
+/** Set the block type of this satellite, and parse it to the corresponding enum
+*/
+void SatSys::setBlockType(
+	string blockType)			///< Block type as used in sinex metadata
+{
+	auto& satData = satDataMap[*this];
+
+	satData.block = blockType;
+
+	std::replace(blockType.begin(), blockType.end(), '-', '_');
+	std::replace(blockType.begin(), blockType.end(), '+', 'P');
+
+	if (E_Block::_is_valid(blockType.c_str()))		satData.blockEnum = E_Block::_from_string_nocase(blockType.c_str());
+	else											satData.blockEnum = E_Block::UNKNOWN;
+}
+
 void SatSys::getId(char* str) const
 {	
 	char sys_c = sysChar();
@@ -44,6 +44,7 @@ struct SatSys
 	struct SatData
 	{
 		string	block;
+		E_Block	blockEnum = E_Block::UNKNOWN;	///< Block type parsed once when set, for dispatching of models
 		string 	svn;
 	};
 
@@ -79,10 +80,7 @@ struct SatSys
 	static map<SatSys, SatData> satDataMap;
 
 	void setBlockType(
-		string blockType)
-	{
-		satDataMap[*this].block = blockType;
-	}
+		string blockType);
 
 	void setSvn(
 		string svn)
@@ -95,6 +93,11 @@ struct SatSys
 		return satDataMap[*this].block;
 	}
 
+	E_Block blockEnum() const
+	{
+		return satDataMap[*this].blockEnum;
+	}
+
 	string svn() const
 	{
 		return satDataMap[*this].svn;
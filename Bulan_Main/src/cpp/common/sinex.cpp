@@ -463,18 +463,6 @@ bool compare(
 	return false;
 }
 
-bool compare(
-	SinexSolMatrix& one,
-	SinexSolMatrix& two)
-{
-	if 	( one.row == two.row
-		&&one.col == two.col)
-	{
-		return true;
-	}
-	return false;
-}
-
 template<typename TYPE>
 void dedupe(list<TYPE>& source)
 {
@@ -566,14 +554,7 @@ void dedupeSinex()
 	dedupeB(theSinex.listgalpcs);
 	dedupeB(theSinex.listnormaleqns);
 
-	for (matrix_type	t = ESTIMATE;		t < MAX_MATRIX_TYPE;	t = static_cast<matrix_type>	(static_cast<int>(t) + 1))
-	for (matrix_value	v = CORRELATION;	v < MAX_MATRIX_VALUE;	v = static_cast<matrix_value>	(static_cast<int>(v) + 1))
-	{
-		if (theSinex.matrixmap[t][v].empty())
-			continue;
-
-		dedupeB(theSinex.matrixmap[t][v]);
-	}
+	//matrices are stored densely by estimate number, duplicates simply overwrite each other
 
 	return;
 }
@@ -2192,45 +2173,83 @@ void writeSnxNormal(ofstream& out, list<SinexRecData>* pstns = nullptr)
 
 matrix_type		mat_type;
 matrix_value	mat_value;
+vector<string>	matrixLines;		///< lines of the current matrix block, parsed together when the block closes
 
-void parseMatrix(string& line)//, matrix_type type, matrix_value value)
+/** Prepare for a matrix block, using the header line to determine where its values belong
+ */
+void startMatrix(
+	const string& header)		///< full header line of the matrix block
 {
-	const char* buff = line.c_str();
+	if		(header.find("MATRIX_ESTIMATE")	!= string::npos)	mat_type = ESTIMATE;
+	else if	(header.find("MATRIX_APRIORI")	!= string::npos)	mat_type = APRIORI;
+	else														mat_type = NORMAL_EQN;
 
-// 	//todo aaron, this is only half complete, the maxrow/col arent used but should be with multiple input matrices.
-	int		maxrow = 0;
-	int		maxcol = 0;
-	SinexSolMatrix smt;
+	if		(header.find("CORR")			!= string::npos)	mat_value = CORRELATION;
+	else if	(header.find("COVA")			!= string::npos)	mat_value = COVARIANCE;
+	else														mat_value = INFORMATION;
+
+	matrixLines.clear();
+}
 
-	int readcount = sscanf(buff, " %5d %5d %21lf %21lf %21lf",
-						&smt.row,
-						&smt.col,
-						&smt.value[0],
-						&smt.value[1],
-						&smt.value[2]);
+void parseMatrix(string& line)
+{
+	matrixLines.push_back(line);
+}
 
-	if (readcount > 2)
+/** Parse all lines of a matrix block into the dense triangular storage for that matrix
+ * The text is converted in parallel, then values are placed according to their estimate numbers
+ */
+void finishMatrix()
+{
+	if (matrixLines.empty())
+		return;
+
+	vector<SinexSolMatrix> entryList(matrixLines.size());
+
+#	ifdef ENABLE_PARALLELISATION
+#		pragma omp parallel for
+#	endif
+	for (int i = 0; i < matrixLines.size(); i++)
 	{
-		if (smt.row < smt.col)
-		{
-			//xor swap
-			smt.row ^= smt.col;
-			smt.col ^= smt.row;
-			smt.row ^= smt.col;
-		}
+		auto& smt = entryList[i];
+
+		int readcount = sscanf(matrixLines[i].c_str(), " %5d %5d %21lf %21lf %21lf",
+							&smt.row,
+							&smt.col,
+							&smt.value[0],
+							&smt.value[1],
+							&smt.value[2]);
+
+		smt.numvals = std::max(readcount - 2, 0);
+	}
+
+	int maxIndex = theSinex.numparam;
+	for (auto& smt : entryList)
+	{
+		if (smt.numvals == 0)
+			continue;
 
-		int covars = readcount - 2;
+		maxIndex = std::max(maxIndex, smt.row);
+		maxIndex = std::max(maxIndex, smt.col + smt.numvals - 1);
+	}
 
-		for (int i = readcount - 2; i < 3; i++)
-			smt.value[i] = -1;
+	auto& matrix = theSinex.matrixmap[mat_type][mat_value];
 
-		smt.numvals = readcount - 2;
+	matrix.reserve(maxIndex);
 
-		if (smt.row > maxrow)		maxrow = smt.row;
-		if (smt.col > maxcol)		maxcol = smt.col;
+	for (auto& smt : entryList)
+	for (int k = 0; k < smt.numvals; k++)
+	{
+		if	(  smt.row			< 1
+			|| smt.col + k		< 1)
+		{
+			continue;
+		}
 
-		theSinex.matrixmap[mat_type][mat_value].push_back(smt);
+		matrix(smt.row, smt.col + k) = smt.value[k];
 	}
+
+	matrixLines.clear();
 }
 
 void parseSinexEstimates(
@@ -3111,6 +3130,11 @@ bool readSinex(
 		else if (line[0] == '-')
 		{
 			//end of block
+			if (parseFunction == parseMatrix)
+			{
+				finishMatrix();
+			}
+
 			parseFunction = nullFunction;
 
 			if (line != closure)
@@ -3146,6 +3170,8 @@ bool readSinex(
 			closure = line;
 			closure[0] = '-';
 
+			string header = line;
+
 			trimCut(line);
 			if		(line == "+FILE/REFERENCE"   				)	{ parseFunction = parseReference;				}
 			else if	(line == "+FILE/COMMENT"					)	{ parseFunction = nullFunction;					}
@@ -3171,9 +3197,9 @@ bool readSinex(
 			else if	(line == "+SOLUTION/ESTIMATE"				)	{ parseFunction = parseSolutionEstimates;		}
 			else if	(line == "+SOLUTION/APRIORI"				)	{ parseFunction = parseApriori;					}
 			else if	(line == "+SOLUTION/NORMAL_EQUATION_VECTOR"	)	{ parseFunction = parseNormals;					}
-			else if	(line == "+SOLUTION/MATRIX_ESTIMATE"		)	{ parseFunction = parseMatrix;					}
-			else if	(line == "+SOLUTION/MATRIX_APRIORI"			)	{ parseFunction = parseMatrix;					}
-			else if	(line == "+SOLUTION/NORMAL_EQUATION_MATRIX"	)	{ parseFunction = parseMatrix;					}
+			else if	(line == "+SOLUTION/MATRIX_ESTIMATE"		)	{ parseFunction = parseMatrix;	startMatrix(header);	}
+			else if	(line == "+SOLUTION/MATRIX_APRIORI"			)	{ parseFunction = parseMatrix;	startMatrix(header);	}
+			else if	(line == "+SOLUTION/NORMAL_EQUATION_MATRIX"	)	{ parseFunction = parseMatrix;	startMatrix(header);	}
 			else if	(line == "+SOLUTION/DATA_HANDLING"			)	{ parseFunction = parseDataHandling;			}
 			else if	(line == "+SATELLITE/IDENTIFIER"			)	{ parseFunction = parseSatelliteIdentifiers;	}
 			else if	(line == "+SATELLITE/PRN"					)	{ parseFunction = parseSatPrns;					}
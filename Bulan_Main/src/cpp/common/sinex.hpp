@@ -350,6 +350,48 @@ struct SinexSolMatrix
 	double	value[3]; // each d21.14 cols col, col+1, col+2 of the row
 };
 
+/** Lower triangle of a symmetric sinex matrix, packed row by row and indexed by (1-based) estimate number
+ */
+struct SinexTriangularMatrix
+{
+	int			size = 0;			///< number of rows and columns
+	VectorXd	values;				///< packed lower triangle, as values[row * (row - 1) / 2 + col - 1]
+
+	/** Grow the matrix to at least the requested size, keeping existing values (new values are zero)
+	 */
+	void reserve(
+		int newSize)
+	{
+		if (newSize <= size)
+			return;
+
+		long int oldLength = values.size();
+		long int newLength = (long int) newSize * (newSize + 1) / 2;
+
+		values.conservativeResize(newLength);
+		values.tail(newLength - oldLength).setZero();
+
+		size = newSize;
+	}
+
+	/** Element of the matrix, either triangle may be requested
+	 */
+	double& operator()(
+		int row,
+		int col)
+	{
+		if (row < col)
+			std::swap(row, col);
+
+		return values[(long int) row * (row - 1) / 2 + col - 1];
+	}
+
+	bool empty()
+	{
+		return size == 0;
+	}
+};
+
 
 //=============================================================================
 /*
@@ -639,7 +681,7 @@ struct Sinex
 	map<string, map<string, map<GTime, SinexSolEstimate, std::greater<GTime>>>>				estimatesMap;
 	map<int, SinexSolApriori>																apriorimap;
 	list<SinexSolNeq>																		listnormaleqns;
-	map<matrix_value,list<SinexSolMatrix>>													matrixmap[MAX_MATRIX_TYPE];
+	map<matrix_value,SinexTriangularMatrix>													matrixmap[MAX_MATRIX_TYPE];
 	map<string,	map<string,	map<char, map<GTime, SinexDataHandling, std::greater<GTime>>>>>	mapdatahandling;
 
 	/* satellite stuff */
@@ -225,11 +225,7 @@ void updateSp3Body(
 	GTime				time,			///< Epoch time.
 	map<E_Sys, bool>&	outSys)			///< Systems to include in file.
 {
-	//first create if non existing
-	{
-		std::fstream maker(filename, std::ios::app);
-	}
-	std::fstream sp3Stream(filename);
+	auto& sp3Stream = getProductStream(filename, time);
 
 	if (!sp3Stream)
 	{
@@ -319,6 +315,8 @@ void updateSp3Body(
 	}
 
 	tracepdeex(0, sp3Stream, "EOF\n");
+
+	sp3Stream.flush();
 }
 
 void writeSysSetSp3(
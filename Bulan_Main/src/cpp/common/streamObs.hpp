@@ -157,6 +157,27 @@ struct ObsStream : StreamParser
 		catch(...){}
 	}
 
+	/** Parse ahead into the observation buffer of this stream if it is safe to do so concurrently with other streams
+	*/
+	void prefetch()
+	{
+		if (parser.isolated() == false)
+		{
+			return;
+		}
+
+		auto obsLister_ptr = dynamic_cast<ObsLister*>(&parser);
+		if (obsLister_ptr == nullptr)
+		{
+			return;
+		}
+
+		if (obsLister_ptr->obsListList.size() < 2)
+		{
+			parse();
+		}
+	}
+
 	bool hasObs()
 	{
 		try
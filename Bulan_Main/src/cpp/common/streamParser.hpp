@@ -79,6 +79,13 @@ struct Parser
 
 	virtual string parserType() = 0;
 
+	/** Check whether this parser only writes to its own members, and may be run concurrently with other parsers
+	*/
+	virtual bool isolated()
+	{
+		return false;
+	}
+
 	virtual ~Parser() = default;
 };
 
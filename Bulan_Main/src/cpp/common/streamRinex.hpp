@@ -10,7 +10,7 @@
 
 struct RinexParser : Parser, ObsLister
 {
-	char							ctype;
+	char							ctype = 0;
 	double							version;
 	E_Sys							nav_system;
 	E_TimeSys						time_system;
@@ -44,4 +44,11 @@ struct RinexParser : Parser, ObsLister
 	{
 		return "RinexParser";
 	}
+
+	/** Observation bodies are decoded into the local obsListList only, headers and navigation files update global maps
+	*/
+	bool isolated()
+	{
+		return ctype == 'O';
+	}
 };
@@ -15,6 +15,7 @@
 */
 
 #include <boost/algorithm/string.hpp>
+#include <functional>
 #include <iostream>
 #include <fstream>
 #include <math.h>
@@ -806,8 +807,135 @@ VectorEnu tideOceanPole(
 	return denu;
 }
 
+/** Time-dependent quantities shared by the tidal models of all receivers
+*/
+struct TideAstro
+{
+	int			erpVersion	= -1;		///< Version of the erp maps the values were computed from
+	GTime		filterTime;				///< Time of the filtered erp values the values were computed from
+	bool		filtered	= false;	///< Values were computed from filtered erp values
+	ERPValues	erpv;
+	MjDateUt1	mjdUt1;
+	VectorEcef	rSun;
+	VectorEcef	rMoon;
+	bool		sunMoon		= false;	///< Sun and moon positions have been computed
+};
+
+/** Get the earth rotation parameters and sun/moon positions for a time.
+* Receivers are processed at the same epochs and tidal nodes, so recent values are kept per thread and reused between receivers.
+* Values are recomputed if the erp maps or filtered erp values have changed since they were cached
+*/
+TideAstro& tideAstro(
+	GTime			time,			///< GPS time
+	bool			sunMoon)		///< Sun and moon positions are required
+{
+	thread_local map<GTime, TideAstro> astroMap;
+
+	auto& filterValues = nav.erp.filterValues;
+
+	auto it = astroMap.find(time);
+	if	(  it != astroMap.end()
+		&&(  it->second.erpVersion	!= nav.erp.version
+		  || it->second.filtered	!= filterValues.isFiltered
+		  ||(filterValues.isFiltered && (it->second.filterTime == filterValues.time) == false)))
+	{
+		astroMap.erase(it);
+		it = astroMap.end();
+	}
+
+	if (it == astroMap.end())
+	{
+		if (astroMap.size() >= 16)
+		{
+			astroMap.erase(astroMap.begin());
+		}
+
+		TideAstro astro;
+		astro.erpVersion	= nav.erp.version;
+		astro.filtered		= filterValues.isFiltered;
+		astro.filterTime	= filterValues.time;
+		astro.erpv			= getErp(nav.erp, time);
+		astro.mjdUt1		= MjDateUt1(time, astro.erpv.ut1Utc);
+
+		it = astroMap.insert({time, astro}).first;
+	}
+
+	auto& astro = it->second;
+
+	if	( sunMoon
+		&&astro.sunMoon == false)
+	{
+		// Sun and Moon positions in ECEF
+		planetPosEcef(time, E_ThirdBody::MOON,	astro.rMoon,	astro.erpv);
+		planetPosEcef(time, E_ThirdBody::SUN,	astro.rSun,		astro.erpv);
+
+		astro.sunMoon = true;
+	}
+
+	return astro;
+}
+
+/** Get a tidal displacement component, interpolated from values at regularly spaced nodes.
+* Uses cubic Lagrange interpolation over the 4 nodes surrounding the epoch, nodes are evaluated once and retained while they are in use.
+* For the semi-diurnal tides the interpolation error is about 1.2e-6 of their amplitude at 10 minute spacing.
+*/
+Vector3d interpolateTideNodes(
+	TideNodes&						nodes,			///< Node cache for this component
+	GTime							time,			///< GPS time
+	double							spacing,		///< Spacing of nodes (s), 0 to evaluate directly at the epoch
+	const VectorEcef&				recPos,			///< Receiver position in ECEF (m)
+	std::function<Vector3d(GTime)>	evaluate)		///< Function to evaluate the component at a time
+{
+	if (spacing <= 0)
+	{
+		return evaluate(time);
+	}
+
+	if ((nodes.nodePos - recPos).norm() > 10)
+	{
+		// receiver has moved enough to change the displacements, start again
+		nodes.nodeMap.clear();
+		nodes.nodePos = recPos;
+	}
+
+	long	first	= (long) floor(time.bigTime / spacing) - 1;
+	double	x		= (double) (time.bigTime / spacing - first);
+
+	auto& nodeMap = nodes.nodeMap;
+	nodeMap.erase(nodeMap.begin(),					nodeMap.lower_bound(first));
+	nodeMap.erase(nodeMap.upper_bound(first + 3),	nodeMap.end());
+
+	Vector3d result = Vector3d::Zero();
+
+	for (int i = 0; i < 4; i++)
+	{
+		long n = first + i;
+
+		auto it = nodeMap.find(n);
+		if (it == nodeMap.end())
+		{
+			GTime nodeTime;
+			nodeTime.bigTime = n * spacing;
+
+			it = nodeMap.insert({n, evaluate(nodeTime)}).first;
+		}
+
+		double weight = 1;
+		for (int j = 0; j < 4; j++)
+		{
+			if (j != i)
+				weight *= (x - j) / (i - j);
+		}
+
+		result += weight * it->second;
+	}
+
+	return result;
+}
+
 /* Tidal displacement by Earth tides
 * See ref [1] 7.1
+* Components may be interpolated from coarse time nodes, as configured by the tide model node spacings
 */
 void tideDisp(
 	Trace&			trace,			///< Trace to output to
@@ -826,32 +954,64 @@ void tideDisp(
 
 	tracepdeex(lv, trace, "\n\n%s: time=%s", __FUNCTION__, time.to_string().c_str());
 
-	ERPValues erpv = getErp(nav.erp, time);
-
-	MjDateUt1 mjdUt1(time, erpv.ut1Utc);
-
 	if (recPos.isZero())
 		return;
 
 	VectorPos pos = ecef2pos(recPos);
 
-	auto& recOpts = acsConfig.getRecOpts(rec.id);
+	auto& recOpts		= acsConfig.getRecOpts(rec.id);
+	auto& tideModels	= recOpts.tideModels;
+	auto& nodeCache		= rec.tideNodeCache;
 
-	VectorEcef	rSun;
-	VectorEcef	rMoon;
+	if (tideModels.solid)
+	{
+		solid	= interpolateTideNodes(nodeCache.solid,	time,	tideModels.solid_node_spacing,	recPos,	[&](GTime t) -> Vector3d
+		{
+			auto& astro = tideAstro(t, true);
+			return tideSolidEarthDehant(trace, t, astro.rSun, astro.rMoon, recPos);
+		});
+	}
 
-	if (recOpts.tideModels.solid)
+	if	( tideModels.otl
+		&&rec.otlDisplacement.empty() == false)
 	{
-		// Sun and Moon positions in ECEF
-		planetPosEcef(time, E_ThirdBody::MOON,	rMoon,	erpv);
-		planetPosEcef(time, E_ThirdBody::SUN,	rSun,	erpv);
+		otl		= interpolateTideNodes(nodeCache.otl,	time,	tideModels.otl_node_spacing,	recPos,	[&](GTime t) -> Vector3d
+		{
+			VectorEnu denu = tideOceanLoadHardisp(trace, t, rec.otlDisplacement);
+			return (Vector3d) enu2ecef(pos, denu);
+		});
+	}
+
+	if	( tideModels.atl
+		&&rec.atlDisplacement.empty() == false)
+	{
+		atl		= interpolateTideNodes(nodeCache.atl,	time,	tideModels.atl_node_spacing,	recPos,	[&](GTime t) -> Vector3d
+		{
+			auto& astro = tideAstro(t, false);
+			VectorEnu denu = tideAtmosLoad(trace, astro.mjdUt1, rec.atlDisplacement);
+			return (Vector3d) enu2ecef(pos, denu);
+		});
 	}
 
-	if (recOpts.tideModels.solid)											{																						solid	= tideSolidEarthDehant(trace, time, rSun, rMoon, recPos);	}
-	if (recOpts.tideModels.otl		&&rec.otlDisplacement.empty() == false)	{	VectorEnu	denu	= tideOceanLoadHardisp	(trace, time,	rec.otlDisplacement);	otl		= (Vector3d) enu2ecef(pos, denu);							}
-	if (recOpts.tideModels.atl		&&rec.atlDisplacement.empty() == false)	{	VectorEnu	denu	= tideAtmosLoad			(trace, mjdUt1,	rec.atlDisplacement);	atl		= (Vector3d) enu2ecef(pos, denu);							}
-	if (recOpts.tideModels.spole)											{	VectorEnu	denu	= tideSolidPole			(trace, mjdUt1, pos, erpv);				spole	= (Vector3d) enu2ecef(pos, denu);							}
-	if (recOpts.tideModels.opole)											{	VectorEnu	denu	= tideOceanPole			(trace, mjdUt1, pos, erpv);				opole	= (Vector3d) enu2ecef(pos, denu);							}
+	if (tideModels.spole)
+	{
+		spole	= interpolateTideNodes(nodeCache.spole,	time,	tideModels.spole_node_spacing,	recPos,	[&](GTime t) -> Vector3d
+		{
+			auto& astro = tideAstro(t, false);
+			VectorEnu denu = tideSolidPole(trace, astro.mjdUt1, pos, astro.erpv);
+			return (Vector3d) enu2ecef(pos, denu);
+		});
+	}
+
+	if (tideModels.opole)
+	{
+		opole	= interpolateTideNodes(nodeCache.opole,	time,	tideModels.opole_node_spacing,	recPos,	[&](GTime t) -> Vector3d
+		{
+			auto& astro = tideAstro(t, false);
+			VectorEnu denu = tideOceanPole(trace, astro.mjdUt1, pos, astro.erpv);
+			return (Vector3d) enu2ecef(pos, denu);
+		});
+	}
 
 	tracepdeex(lv, trace, "\n%s   SOLID       %14.6f %14.6f %14.6f", timeStr.c_str(), solid	[0], solid	[1], solid	[2]);
 	tracepdeex(lv, trace, "\n%s   OCEAN       %14.6f %14.6f %14.6f", timeStr.c_str(), otl	[0], otl	[1], otl	[2]);
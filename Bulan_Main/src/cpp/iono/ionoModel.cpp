@@ -69,6 +69,29 @@ double ionModelCoef(
 	}
 }
 
+/** Evaluates all basis functions of the ionosphere model for an observation.
+ * Models with a batched evaluator compute the whole row at once, others are evaluated one basis function at a time
+ */
+VectorXd ionModelCoefs(
+	Trace&		trace,
+	IonoObs&	obs,
+	bool		slant)
+{
+	if (acsConfig.ionModelOpts.model == +E_IonoModel::SPHERICAL_HARMONICS)
+	{
+		return ionCoefsSphhar(trace, obs, slant);
+	}
+
+	VectorXd coeffs = VectorXd::Zero(acsConfig.ionModelOpts.numBasis);
+
+	for (int i = 0; i < acsConfig.ionModelOpts.numBasis; i++)
+	{
+		coeffs(i) = ionModelCoef(trace, i, obs, slant);
+	}
+
+	return coeffs;
+}
+
 /** Updating the ionosphere model parameters
  * The ionosphere model should be initialized by calling 'config_ionosph_model'
  * Ionosphere measurments from stations should be loaded using 'update_station_measr'
@@ -257,9 +280,12 @@ void filterIonosphere(
 
 		/************ Ionosphere basis ************/
 		obs.ionoSat = obs.Sat;
+
+		VectorXd coefs = ionModelCoefs(trace, obs, true);
+
 		for (int i = 0; i < acsConfig.ionModelOpts.numBasis; i++)
 		{
-			double coef = ionModelCoef(trace,i, obs, true);
+			double coef = coefs(i);
 
 			if (coef == 0)
 				continue;
@@ -68,6 +68,9 @@ double ionCoefSphcap(Trace& trace, int ind, IonoObs& obs, bool slant = true);
 double ionCoefBsplin(Trace& trace, int ind, IonoObs& obs, bool slant = true);
 double ionCoefLocal (Trace& trace, int ind, IonoObs& obs);
 
+VectorXd ionModelCoefs	(Trace& trace, IonoObs& obs, bool slant = true);
+VectorXd ionCoefsSphhar	(Trace& trace, IonoObs& obs, bool slant = true);
+
 double ionVtecSphhar(Trace& trace, GTime time, VectorPos& ionPP, int layer, double& var, KFState& kfState);
 double ionVtecSphcap(Trace& trace, GTime time, VectorPos& ionPP, int layer, double& var, KFState& kfState);
 double ionVtecBsplin(Trace& trace, GTime time, VectorPos& ionPP, int layer, double& var, KFState& kfState);
@@ -200,6 +200,89 @@ double ionCoefSphhar(
 	return coeff;
 }
 
+/** Evaluates all spherical harmonics basis functions for an observation in a single pass.
+ * The Legendre functions are computed once per layer, and the longitude terms are built up by angle addition rather than per basis function.
+ * Basis functions for layers without a piercing point in the observation are left as zero.
+ */
+VectorXd ionCoefsSphhar(
+	Trace&		trace,			///< Trace to output to
+	IonoObs&	obs,			///< Ionospheric observation metadata
+	bool		slant)			///< apply slant factor, false: coefficients for VTEC, true: coefficients for STEC
+{
+	int numBasis = acsConfig.ionModelOpts.numBasis;
+
+	VectorXd coeffs = VectorXd::Zero(numBasis);
+
+	thread_local Legendre legendre;
+	if (legendre.nmax != ionLeg.nmax)
+		legendre.setNmax(ionLeg.nmax);
+
+	int maxOrder = acsConfig.ionModelOpts.function_order;
+
+	vector<double> cosm(maxOrder + 1);
+	vector<double> sinm(maxOrder + 1);
+
+	int		layer	= -1;
+	bool	valid	= false;
+	double	scale	= 1;
+
+	for (auto& [ind, basis] : sphBasisMap)
+	{
+		if (ind >= numBasis)
+			break;
+
+		if (basis.order		> acsConfig.ionModelOpts.function_order)
+			continue;
+
+		if (basis.degree	> acsConfig.ionModelOpts.function_degree)
+			continue;
+
+		if (basis.layer != layer)
+		{
+			layer = basis.layer;
+
+			auto it = obs.ippMap.find(layer);
+			valid = (it != obs.ippMap.end());
+			if (valid == false)
+				continue;
+
+			auto& ipp = it->second;
+
+			legendre.calculate(cos(ipp.latDeg * D2R));
+
+			double lon		= ipp.lonDeg * D2R;
+			double cosLon	= cos(lon);
+			double sinLon	= sin(lon);
+
+			cosm[0] = 1;
+			sinm[0] = 0;
+			for (int m = 1; m <= maxOrder; m++)
+			{
+				cosm[m] = cosm[m-1] * cosLon - sinm[m-1] * sinLon;
+				sinm[m] = sinm[m-1] * cosLon + cosm[m-1] * sinLon;
+			}
+
+			if (slant)	scale = ipp.slantFactor;
+			else		scale = 1;
+		}
+
+		if (valid == false)
+			continue;
+
+		double coeff = legendre.Pnm(basis.degree, basis.order);
+
+		if (basis.order % 2)
+			coeff = -coeff;
+
+		if		(basis.trigType == +E_TrigType::SIN)		coeff *= sinm[basis.order];
+		else if (basis.trigType == +E_TrigType::COS)		coeff *= cosm[basis.order];
+
+		coeffs(ind) = coeff * scale;
+	}
+
+	return coeffs;
+}
+
 /** Estimate Ionosphere VTEC using Spherical Cap Harmonic models
 	gtime_t  time		I		time of solutions (not useful for this one
 	Ion_pp				I		Ionosphere Piercing Point
@@ -229,6 +312,8 @@ double ionVtecSphhar(
 
 	double iono = 0;
 
+	VectorXd coefs = ionCoefsSphhar(trace, tmpobs, false);
+
 	for (int basisNum = 0; basisNum < acsConfig.ionModelOpts.numBasis; basisNum++)
 	{
 		auto& basis = sphBasisMap[basisNum];
@@ -236,7 +321,7 @@ double ionVtecSphhar(
 		if (basis.layer != layer)
 			continue;
 
-		double coef = ionCoefSphhar(trace, basisNum, tmpobs, false);
+		double coef = coefs(basisNum);
 
 		KFKey key;
 		key.type	= KF::IONOSPHERIC;
@@ -387,11 +472,15 @@ bool getEpcSsrIono(
 		tmpobs.ippMap[layer].lonDeg			= posp.lonDeg();
 		tmpobs.ippMap[layer].slantFactor	= slantFactor;
 
+		VectorXd comps = ionCoefsSphhar(trace, tmpobs, true);
+
 		for (auto& [ind, harmonic] : atmLay.sphHarmonic)
 		{
 			int reindex = sphBasisIndexMaps[harmonic.layer][harmonic.degree][harmonic.order][harmonic.trigType];
 
-			double comp = ionCoefSphhar(trace, reindex, tmpobs, true);
+			double comp = 0;
+			if (reindex < comps.size())
+				comp = comps(reindex);
 
 			iono	+=		comp	* harmonic.value;
 			var		+= SQR(	comp)	* harmonic.variance;
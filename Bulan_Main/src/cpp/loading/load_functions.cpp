@@ -11,6 +11,7 @@
 #include <iostream>
 #include <fstream>
 #include <iomanip>
+#include <vector>
 
 #include "loading.h"
 #include "tide.h"
@@ -19,71 +20,82 @@
 #include "utils.h"
 
 /** Compute the loading of a single point
+ *
+ * The Green's functions for each grid cell are applied to all tides as they are computed,
+ * so the grid is traversed once and no intermediate grids of Green's function values are needed.
  */
 void load_1_point(
 	tide*		tide_info,		///< vector of classes containing the tide grids
 	otl_input*	input,			///< class containing the coordinates information and also the loading vector
-	loading		load,			///< class containing the Green's function
+	loading&	load,			///< class containing the Green's function
 	int			idx)			///< index of the point in the list
 {
-	MA2d greenZ;
-	MA2d greenNS;
-	MA2d greenEW;
+	int ntide = input->tide_file.size();
+
+	std::vector<double*> tidere_its(ntide);
+	std::vector<double*> tideim_its(ntide);
+	for (int it = 0; it < ntide; it++)
+	{
+		tidere_its[it] = tide_info[it].get_in_ptr();
+		tideim_its[it] = tide_info[it].get_out_ptr();
+	}
 
-	greenZ.	resize(boost::extents[tide_info[0].get_nlat()][tide_info[0].get_nlon()]);
-	greenNS.resize(boost::extents[tide_info[0].get_nlat()][tide_info[0].get_nlon()]);
-	greenEW.resize(boost::extents[tide_info[0].get_nlat()][tide_info[0].get_nlon()]);
+	// accumulate locally, to keep threads processing other points from sharing cache lines
+	std::vector<double> dispEW_in	(ntide, 0.0);
+	std::vector<double> dispEW_out	(ntide, 0.0);
+	std::vector<double> dispZ_in	(ntide, 0.0);
+	std::vector<double> dispZ_out	(ntide, 0.0);
+	std::vector<double> dispNS_in	(ntide, 0.0);
+	std::vector<double> dispNS_out	(ntide, 0.0);
 
-	auto greenZ_it = greenZ.origin();
-	auto greenEW_it = greenEW.origin();
-	auto greenNS_it = greenNS.origin();
 	float lat0 = input->lat[idx];
 	float lon0 = input->lon[idx];
 
+	size_t icell = 0;
 	for (float *lat_ptr = tide_info[0].get_lat_ptr(); lat_ptr != tide_info[0].get_lat_ptr_end(); lat_ptr++) 
-	for (float *lon_ptr = tide_info[0].get_lon_ptr(); lon_ptr < tide_info[0].get_lon_ptr_end(); lon_ptr++) 
+	for (float *lon_ptr = tide_info[0].get_lon_ptr(); lon_ptr < tide_info[0].get_lon_ptr_end(); lon_ptr++, icell++) 
 	{
 		double dist, azimuth;
 		calcDistanceBearing(&lat0, &lon0, lat_ptr, lon_ptr, &dist, &azimuth);
 
-		*greenZ_it = load.interpolate_gz(dist);
-		*greenNS_it = load.interpolate_gh(dist) * cos(azimuth);
-		*greenEW_it = load.interpolate_gh(dist) * sin(azimuth);
+		double greenZ;
+		double greenH;
+		load.interpolate_green(dist, greenZ, greenH);
+
+		double greenNS = greenH * cos(azimuth);
+		double greenEW = greenH * sin(azimuth);
 
-		// *greenNS_it *= cos(azimuth);
-		// *greenEW_it *= sin(azimuth);
-		if (*greenZ_it != *greenZ_it)
+		if (greenZ != greenZ)
 		{
 			std::cout << " nan detected for " << *lat_ptr << " " <<*lon_ptr << "\n";
 			std::cout << dist << "  " << azimuth << "\n";
 			exit(0);
 		}
-		greenZ_it++;
-		greenNS_it++;
-		greenEW_it++;
-	}
-	
-	// Computing load
-	for (int it = 0 ; it < input->tide_file.size() ; it++ ) 
-	{
-		auto tideim_it = tide_info[it].get_out_ptr();
-		auto gz_it = greenZ.origin();
-		auto gNS_it = greenNS.origin();
-		auto gEW_it = greenEW.origin();
-		for (auto tidere_it = tide_info[it].get_in_ptr();
-			 tidere_it != tide_info[it].get_in_ptr_end();
-			 tidere_it++, tideim_it++, gz_it++, gNS_it++, gEW_it++) 
-		{
-			
-			input->dispEW_in[idx][it] += *gEW_it * *tidere_it;
-			input->dispEW_out[idx][it]+= *gEW_it * *tideim_it;
-			input->dispZ_in[idx][it]  += *gz_it  * *tidere_it;
-			input->dispZ_out[idx][it] += *gz_it  * *tideim_it;
-			input->dispNS_in[idx][it] += *gNS_it * *tidere_it;
-			input->dispNS_out[idx][it]+= *gNS_it * *tideim_it;
 
+		// Computing load
+		for (int it = 0; it < ntide; it++)
+		{
+			double tidere = tidere_its[it][icell];
+			double tideim = tideim_its[it][icell];
+
+			dispEW_in	[it] += greenEW * tidere;
+			dispEW_out	[it] += greenEW * tideim;
+			dispZ_in	[it] += greenZ  * tidere;
+			dispZ_out	[it] += greenZ  * tideim;
+			dispNS_in	[it] += greenNS * tidere;
+			dispNS_out	[it] += greenNS * tideim;
 		}
 	}
+
+	for (int it = 0; it < ntide; it++)
+	{
+		input->dispEW_in[idx][it] += dispEW_in	[it];
+		input->dispEW_out[idx][it]+= dispEW_out	[it];
+		input->dispZ_in[idx][it]  += dispZ_in	[it];
+		input->dispZ_out[idx][it] += dispZ_out	[it];
+		input->dispNS_in[idx][it] += dispNS_in	[it];
+		input->dispNS_out[idx][it]+= dispNS_out	[it];
+	}
 }
 
 void write_BLQ(otl_input *input, int mode)
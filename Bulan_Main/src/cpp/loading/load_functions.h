@@ -11,7 +11,7 @@
 #include "input_otl.h"
 #include "loading.h"
 
-void load_1_point(tide *tide_info, otl_input *input, loading load,  int idx);
+void load_1_point(tide *tide_info, otl_input *input, loading& load,  int idx);
 void write_BLQ(otl_input *input);
 void write_BLQ(otl_input *input, int code);
 
@@ -9,6 +9,7 @@
 #include <fstream>
 #include <sstream>
 #include <iostream>
+#include <algorithm>
 #include <vector>
 #include <cmath>
 
@@ -19,20 +20,25 @@ const double PI = std::atan(1.0)*4;
 
 using namespace std;
 
-double interpolate( vector<double> &xData, vector<double> &yData, double x, bool extrapolate )
+/** Find left end of interval for interpolation, searching the sorted distances by bisection
+ */
+int find_interval( vector<double> &xData, double x )
 {
 	int size =  xData.size();
-	int i = 0;// find left end of interval for interpolation
 
-	if (x==0) return (double) 0.0;
 	if ( x >= xData[size - 2] )                                                 // special case: beyond right end
 	{
-		i = size - 2;
-	}
-	else
-	{
-		while ( x > xData[i+1] ) i++;
+		return size - 2;
 	}
+
+	// first node at or beyond x, the interval ends there
+	return std::lower_bound(xData.begin() + 1, xData.end() - 2, x) - xData.begin() - 1;
+}
+
+double interpolate( vector<double> &xData, vector<double> &yData, double x, bool extrapolate, int i )
+{
+	if (x==0) return (double) 0.0;
+
 	double xL = xData[i], yL = yData[i], xR = xData[i+1], yR = yData[i+1];      // points on either side (unless beyond ends)
 	if ( !extrapolate )                                                         // if beyond ends of array and not extrapolating
 	{
@@ -44,6 +50,15 @@ double interpolate( vector<double> &xData, vector<double> &yData, double x, bool
 	return  ret;                                            // linear interpolation
 };
 
+double interpolate( vector<double> &xData, vector<double> &yData, double x, bool extrapolate )
+{
+	if (x==0) return (double) 0.0;
+
+	int i = find_interval(xData, x);
+
+	return interpolate(xData, yData, x, extrapolate, i);
+};
+
 loading::loading() {};
 
 loading::loading(std::string fname):
@@ -92,4 +107,20 @@ double loading::interpolate_gz(double x) {
 
 double loading::interpolate_gh(double x) {
 	return interpolate( dist, Gh,  x, false );
+}
+
+/** Interpolate both the vertical and horizontal Green's functions, sharing the search for the distance interval
+ */
+void loading::interpolate_green(double x, double& gz, double& gh) {
+	if (x==0)
+	{
+		gz = 0;
+		gh = 0;
+		return;
+	}
+
+	int i = find_interval(dist, x);
+
+	gz = interpolate( dist, Gz,  x, false, i );
+	gh = interpolate( dist, Gh,  x, false, i );
 }
\ No newline at end of file
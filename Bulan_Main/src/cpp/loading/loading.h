@@ -20,6 +20,7 @@ public:
 	void read();
 	double interpolate_gz(double);
 	double interpolate_gh(double);
+	void interpolate_green(double, double&, double&);
 
 private:
 	std::string fileName;
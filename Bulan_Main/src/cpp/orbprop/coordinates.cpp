@@ -21,9 +21,15 @@
 #include <iomanip>
 #include <iostream>
 #include <string>
+#include <mutex>
 
+using std::shared_lock;
+using std::unique_lock;
 
-array<FrameSwapper, 2> FrameSwapper::cacheArr;
+
+array<FrameSwapper, FrameSwapper::CACHE_SIZE>	FrameSwapper::cacheArr;
+int												FrameSwapper::cacheNext = 0;
+shared_mutex									FrameSwapper::cacheMutex;
 
 FrameSwapper::FrameSwapper(
 			GTime		time,
@@ -31,13 +37,17 @@ FrameSwapper::FrameSwapper(
 :	time0	{time},
 	erpv	{erpv}
 {
-	for (auto& cache : cacheArr)
 	{
-		if	( time0	== cache.time0
-			&&erpv	== cache.erpv)
+		shared_lock<shared_mutex> guard(cacheMutex);
+
+		for (auto& cache : cacheArr)
 		{
-			*this = cache;
-			return;
+			if	( time0	== cache.time0
+				&&erpv	== cache.erpv)
+			{
+				*this = cache;
+				return;
+			}
 		}
 	}
 
@@ -49,6 +59,29 @@ FrameSwapper::FrameSwapper(
 
 		translation = cmc.estimate(dood_arr);
 	}
+
+	setCache();
+}
+
+/** Add this transformation to the cache shared by all threads, replacing the oldest entry
+ */
+void FrameSwapper::setCache()
+{
+	unique_lock<shared_mutex> guard(cacheMutex);
+
+	//another thread may have added the same transformation while this one was computed
+	for (auto& cache : cacheArr)
+	{
+		if	( time0	== cache.time0
+			&&erpv	== cache.erpv)
+		{
+			return;
+		}
+	}
+
+	cacheArr[cacheNext] = *this;
+
+	cacheNext = (cacheNext + 1) % CACHE_SIZE;
 }
 
 void eci2ecef(
@@ -101,10 +134,20 @@ void eci2ecef(
 	Matrix3d theta;
 	theta = Eigen::AngleAxisd(-era, Vector3d::UnitZ());
 
-	double X_iau = 0;
-	double Y_iau = 0;
-	double S_iau = 0;
-	Sofa::iauXys(mjDateTT, X_iau, Y_iau, S_iau);
+	//precession-nutation depends only on time, reuse it when only the erp values differ
+	thread_local GTime	xysTime;
+	thread_local double	xysArr[3] = {};
+
+	if (time != xysTime)
+	{
+		Sofa::iauXys(mjDateTT, xysArr[0], xysArr[1], xysArr[2]);
+
+		xysTime = time;
+	}
+
+	double X_iau = xysArr[0];
+	double Y_iau = xysArr[1];
+	double S_iau = xysArr[2];
 	X_iau += dx00;
 	Y_iau += dy00;
 	Matrix<double, 3, 3, Eigen::RowMajor> RC2I;
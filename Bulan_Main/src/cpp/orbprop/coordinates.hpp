@@ -1,8 +1,10 @@
 
 #pragma once
 
+#include <shared_mutex>
 #include <array>
 
+using std::shared_mutex;
 using std::array;
 
 #include "centerMassCorrections.hpp"
@@ -88,7 +90,10 @@ Vector3d ecef2body(
 
 struct FrameSwapper
 {
-	static array<FrameSwapper, 2> cacheArr;
+	static const int						CACHE_SIZE = 16;
+	static array<FrameSwapper, CACHE_SIZE>	cacheArr;		///< Recently computed transformations, shared by all threads
+	static int								cacheNext;		///< Index of the oldest entry in the cache, to be replaced next
+	static shared_mutex						cacheMutex;
 
 	GTime		time0;
 	ERPValues	erpv;
@@ -97,11 +102,7 @@ struct FrameSwapper
 	Matrix3d	di2t_mat;
 	Vector3d	translation = Vector3d::Zero();
 
-	void setCache(
-		int cache)
-	{
-		cacheArr[cache] = *this;
-	}
+	void setCache();
 
 	FrameSwapper()
 	{
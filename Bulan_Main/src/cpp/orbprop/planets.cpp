@@ -1,24 +1,226 @@
 
 // #pragma GCC optimize ("O0")
 
+#include <algorithm>
 #include <iostream>
-#include <mutex>  
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <map>
 
+using std::make_shared;
+using std::shared_ptr;
 using std::lock_guard;
+using std::map;
 
 #include "coordinates.hpp"
 #include "navigation.hpp"
 #include "constants.hpp"
 #include "jpl_eph.hpp"
+#include "jpl_int.hpp"
 #include "planets.hpp"
 #include "enums.h"
 #include "erp.hpp"
 #include "sofa.h"
 
 
-std::mutex jplEphMutex;
+/** Chebyshev coefficients of a single record of the JPL ephemeris file.
+ * Records are never modified once loaded, so they may be evaluated from any thread without locking
+ */
+struct JplRecord
+{
+	uint32_t		recordNum;		///< Index of the record within the file
+	vector<double>	coeffs;			///< Coefficients of all quantities in the record
+};
+
+/** Records loaded from a single ephemeris file, a new ephemeris file starts with an empty map
+ */
+struct JplRecordMap : map<uint32_t, shared_ptr<const JplRecord>>
+{
+	const jpl_eph_data*	eph_ptr	= nullptr;	///< Ephemeris that the records were read from
+};
+
+const int MAX_JPL_RECORDS = 4;		///< Number of records to keep loaded, each spans several days
+
+std::mutex						jplEphMutex;			///< Serialises file reads of new records only
+shared_ptr<const JplRecordMap>	jplRecordMap_ptr;		///< Loaded records, replaced (never modified) when a new record is needed
+
+/** Cached result of a single body at a single epoch
+ */
+struct JplCacheEntry
+{
+	const jpl_eph_data*	eph_ptr	= nullptr;	///< Ephemeris that the values were computed from
+	double				et		= 0;
+	bool				hasVel	= false;
+	Vector3d			pos;
+	Vector3d			vel;
+};
+
+thread_local JplCacheEntry jplCache[E_ThirdBody::_size() + 1];
+
+/** Get the coefficients of a record, loading it from the file if not already available
+ */
+shared_ptr<const JplRecord> getJplRecord(
+	jpl_eph_data&	eph,			///< JPL ephemeris data
+	uint32_t		recordNum)		///< Index of record to retrieve
+{
+	auto recordMap_ptr = std::atomic_load(&jplRecordMap_ptr);
+	if	(  recordMap_ptr
+		&& recordMap_ptr->eph_ptr == &eph)
+	{
+		auto it = recordMap_ptr->find(recordNum);
+		if (it != recordMap_ptr->end())
+		{
+			return it->second;
+		}
+	}
+
+	lock_guard<std::mutex> guard(jplEphMutex);
+
+	//check again, another thread may have loaded it while waiting for the lock
+	recordMap_ptr = std::atomic_load(&jplRecordMap_ptr);
+	if	(  recordMap_ptr
+		&& recordMap_ptr->eph_ptr == &eph)
+	{
+		auto it = recordMap_ptr->find(recordNum);
+		if (it != recordMap_ptr->end())
+		{
+			return it->second;
+		}
+	}
+
+	auto record_ptr = make_shared<JplRecord>();
+	auto& record = *record_ptr;
+
+	record.recordNum = recordNum;
+	record.coeffs.resize(eph.ncoeff);
+
+	//skip two blocks for the header
+	if (fseek(eph.ifile, (long) (recordNum + 2) * eph.recsize, SEEK_SET))
+	{
+		return nullptr;
+	}
+
+	if (fread(record.coeffs.data(), sizeof(double), eph.ncoeff, eph.ifile) != eph.ncoeff)
+	{
+		return nullptr;
+	}
+
+	if (eph.swap_bytes)
+	for (auto& coeff : record.coeffs)
+	{
+		char* bytes = (char*) &coeff;
+		std::reverse(bytes, bytes + sizeof(double));
+	}
+
+	//keep the records closest to the new one, unless they were read from a different ephemeris
+	auto newRecordMap_ptr = make_shared<JplRecordMap>();
+	if	(  recordMap_ptr
+		&& recordMap_ptr->eph_ptr == &eph)
+	{
+		*newRecordMap_ptr = *recordMap_ptr;
+	}
+
+	auto& newRecordMap = *newRecordMap_ptr;
+	newRecordMap.eph_ptr = &eph;
+
+	newRecordMap[recordNum] = record_ptr;
+
+	while (newRecordMap.size() > MAX_JPL_RECORDS)
+	{
+		auto first	= newRecordMap.begin();
+		auto last	= std::prev(newRecordMap.end());
+
+		if (recordNum - first->first > last->first - recordNum)		newRecordMap.erase(first);
+		else														newRecordMap.erase(last);
+	}
+
+	std::atomic_store(&jplRecordMap_ptr, shared_ptr<const JplRecordMap>(newRecordMap_ptr));
+
+	return record_ptr;
+}
+
+/** Interpolate the chebyshev coefficients of one quantity in a record, to give position and velocity.
+ * Equivalent to interp() of the jpl library, but without its shared state
+ */
+void jplInterp(
+	const double*	coef,			///< First coefficient of the quantity
+	double			t,				///< Fractional time within the record (0 <= t <= 1)
+	double			step,			///< Length of the record (days)
+	unsigned int	ncf,			///< Number of coefficients per component
+	unsigned int	na,				///< Number of sub-intervals in the record
+	bool			calcVel,		///< Option to calculate velocity
+	double			posvel[6])		///< Output position and optional velocity
+{
+	double	temp	= na * t;
+	int		l		= (int) temp;
+	double	unused;
+	double	tc		= 2 * modf(temp, &unused) - 1;
+
+	if (l == na)
+	{
+		l--;
+		tc = 1;
+	}
+
+	double posCoeffs[MAX_CHEBY];
+	double velCoeffs[MAX_CHEBY];
+
+	posCoeffs[0] = 1;
+	posCoeffs[1] = tc;
+	velCoeffs[0] = 0;
+	velCoeffs[1] = 1;
+
+	double twot = tc + tc;
+
+	for (int j = 2; j < ncf; j++)
+	{
+		posCoeffs[j] = twot * posCoeffs[j-1] - posCoeffs[j-2];
+	}
+
+	for (int i = 0; i < 3; i++)
+	{
+		const double* coeff_ptr = coef + ncf * (i + l * 3);
 
+		double sum = 0;
+		for (int j = ncf - 1; j >= 0; j--)
+		{
+			sum += posCoeffs[j] * coeff_ptr[j];
+		}
 
+		posvel[i] = sum;
+	}
+
+	if (calcVel == false)
+	{
+		return;
+	}
+
+	for (int j = 2; j < ncf; j++)
+	{
+		velCoeffs[j] = twot * velCoeffs[j-1] + posCoeffs[j-1] + posCoeffs[j-1] - velCoeffs[j-2];
+	}
+
+	double vfac = (na + na) / step;
+
+	for (int i = 0; i < 3; i++)
+	{
+		const double* coeff_ptr = coef + ncf * (i + l * 3);
+
+		double sum = 0;
+		for (int j = ncf - 1; j >= 1; j--)
+		{
+			sum += velCoeffs[j] * coeff_ptr[j];
+		}
+
+		posvel[3 + i] = sum * vfac;
+	}
+}
+
+/** Geocentric position and velocity of a body from the JPL ephemerides.
+ * Records of the ephemeris file are loaded once into immutable coefficient blocks and evaluated without locking,
+ * repeated queries for the same body and epoch by a thread are returned directly
+ */
 bool jplEphPos(
 	struct jpl_eph_data*	jplEph_ptr,			///< Pointer to jpl binary data
 	MjDateTT				mjdTT,				///< Julian_TT
@@ -32,39 +234,121 @@ bool jplEphPos(
 		
 		return false;
 	}
-	
-	int result;
-	double r_p[6];
+
+	auto&	eph		= *jplEph_ptr;
+	double	et		= mjdTT.to_double() + JD2MJD;
+	bool	calcVel	= vel_ptr;
+	int		nState	= calcVel ? 6 : 3;		//velocities are only interpolated when requested
+
+	auto& cacheEntry = jplCache[thirdBody];
+	if	(  cacheEntry.eph_ptr	== jplEph_ptr
+		&& cacheEntry.et		== et
+		&&(cacheEntry.hasVel || calcVel == false))
 	{
-		lock_guard<mutex> guard(jplEphMutex);
-		
-		result = jpl_pleph(jplEph_ptr, mjdTT.to_double() + JD2MJD, thirdBody, eEarth, r_p, !!vel_ptr);
-	}
-
-	switch (result)
-	{
-		case 0:
-			pos(0) = r_p[0] * AU;
-			pos(1) = r_p[1] * AU;
-			pos(2) = r_p[2] * AU;
-
-			if (vel_ptr)
-			{
-				auto& vel = *vel_ptr;
-				vel(0) = r_p[3] * AUPerDay;
-				vel(1) = r_p[4] * AUPerDay;
-				vel(2) = r_p[5] * AUPerDay;
-			}
-			return true;
-		case -1:		std::cout << "JPL_EPH_OUTSIDE_RANGE"				<< "\n";	break;
-		case -2:		std::cout << "JPL_EPH_READ_ERROR"					<< "\n";	break;
-		case -3:		std::cout << "JPL_EPH_QUANTITY_NOT_IN_EPHEMERIS"	<< "\n";	break;
-		case -5:		std::cout << "JPL_EPH_INVALID_INDEX"				<< "\n";	break;
-		case -6:		std::cout << "JPL_EPH_FSEEK_ERROR"					<< "\n";	break;
-		default:		std::cout << "Result is out of Known Situation"		<< "\n";	break;
+		pos = cacheEntry.pos;
+
+		if (vel_ptr)
+		{
+			*vel_ptr = cacheEntry.vel;
+		}
+
+		return true;
 	}
-	
-	return false;
+
+	if	( et < eph.ephem_start
+		||et > eph.ephem_end)
+	{
+		std::cout << "JPL_EPH_OUTSIDE_RANGE" << "\n";
+
+		return false;
+	}
+
+	//calculate record # and relative time in interval
+	double		blockLoc	= (et - eph.ephem_start) / eph.ephem_step;
+	uint32_t	recordNum	= (uint32_t) blockLoc;
+	double		t			= blockLoc - recordNum;
+	if	(  t == 0
+		&& recordNum)
+	{
+		t = 1;
+		recordNum--;
+	}
+
+	auto record_ptr = getJplRecord(eph, recordNum);
+	if (record_ptr == nullptr)
+	{
+		std::cout << "JPL_EPH_READ_ERROR" << "\n";
+
+		return false;
+	}
+
+	const double* buf = record_ptr->coeffs.data();
+
+	double aufac = 1 / eph.au;
+
+	//state of a quantity in the record (indexed as in the jpl ipt array), converted to AU
+	auto getState = [&](int index, double pv[6])
+	{
+		auto& ipt = eph.ipt[index];
+
+		jplInterp(&buf[ipt[0] - 1], t, eph.ephem_step, ipt[1], ipt[2], calcVel, pv);
+
+		for (int j = 0; j < nState; j++)
+		{
+			pv[j] *= aufac;
+		}
+	};
+
+	double rrd[6] = {};
+
+	if (thirdBody == +E_ThirdBody::MOON)
+	{
+		//moon is stored geocentric
+		getState(eMoon - 1, rrd);
+	}
+	else if (thirdBody != +E_ThirdBody::EARTH)
+	{
+		double moon	[6] = {};
+		double earth[6] = {};
+		double body	[6] = {};
+
+		getState(eMoon	- 1, moon);
+		getState(eEarth	- 1, earth);		//earth-moon barycentre is stored in place of the earth
+
+		for (int j = 0; j < nState; j++)
+		{
+			earth[j] -= moon[j] / (1 + eph.emrat);
+		}
+
+		if (thirdBody == +E_ThirdBody::SUN)		getState(eSun		- 1, body);
+		else									getState(thirdBody	- 1, body);
+
+		for (int j = 0; j < nState; j++)
+		{
+			rrd[j] = body[j] - earth[j];
+		}
+	}
+
+	pos(0) = rrd[0] * AU;
+	pos(1) = rrd[1] * AU;
+	pos(2) = rrd[2] * AU;
+
+	cacheEntry.eph_ptr	= jplEph_ptr;
+	cacheEntry.et		= et;
+	cacheEntry.hasVel	= calcVel;
+	cacheEntry.pos		= pos;
+
+	if (vel_ptr)
+	{
+		auto& vel = *vel_ptr;
+		vel(0) = rrd[3] * AUPerDay;
+		vel(1) = rrd[4] * AUPerDay;
+		vel(2) = rrd[5] * AUPerDay;
+
+		cacheEntry.vel = vel;
+	}
+
+	return true;
 }
 
 bool planetPosEcef(
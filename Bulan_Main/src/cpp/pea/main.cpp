@@ -19,7 +19,8 @@
  * Unlike observation streams, which provide data up until the requested epoch time, other streams such as navigation streams parse all data available to them,
  * and output any values to global maps, which may be later accessed as required by other components.
  *
- * The synchronisation process parses all streams sequentially, without multithreading, so map collisions are not expected.
+ * The synchronisation process parses all streams that write to global maps sequentially, without multithreading, so map collisions are not expected.
+ * Observation streams whose parsers are isolated from global maps (eg. rinex observation files) are parsed ahead concurrently before being synchronised.
  */
 Architecture Streams_And_Synchronisation__()
 {
@@ -62,6 +63,7 @@ using std::string;
 #include "rinexObsWrite.hpp"
 #include "rinexClkWrite.hpp"
 #include "algebraTrace.hpp"
+#include "benchmark.hpp"
 #include "rtsSmoothing.hpp"
 #include "observations.hpp"
 #include "preprocessor.hpp"
@@ -75,6 +77,7 @@ using std::string;
 #include "testUtils.hpp"
 #include "orbitProp.hpp"
 #include "ionoModel.hpp"
+#include "parallel.hpp"
 #include "receiver.hpp"
 #include "posProp.hpp"
 #include "summary.hpp"
@@ -140,6 +143,8 @@ void mainOncePerEpochPerStation(
 
 	sinexPerEpochPerStation(trace, tsync, rec);
 
+	resolveAntennaHandle(rec.antennaHandle, rec.antennaId);
+
 	preprocessor(trace, rec, true);
 
 	//recalculate variances now that elevations are known due to satellite postions calculation above
@@ -314,6 +319,8 @@ void mainOncePerEpochPerSatellite(
 	satNav.antBoresight	= satOpts.antenna_boresight;
 	satNav.antAzimuth	= satOpts.antenna_azimuth;
 
+	resolveAntennaHandle(satNav.antennaHandle, Sat.id());
+
 	selectAprioriSource(Sat, time, kfState, &remoteKF);
 }
 
@@ -344,6 +351,9 @@ void mainOncePerEpoch(
 
 	auto pppTrace = getTraceFile(pppNet);
 
+	//prepare precise orbit arcs to be shared by all receivers this epoch
+	updatePreciseArcs(pppTrace, time, nav);
+
 	//initialise mongo if not already done
 	mongoooo();
 
@@ -375,14 +385,13 @@ void mainOncePerEpoch(
 		nav.erp.filterValues = getErpFromFilter(pppNet.kfState);
 	}
 
+	//prepare the frame transformations for this epoch, these are cached when created
 	const int DT = 1;
 	for (int dt : {DT, 0})
 	{
 		ERPValues erpv = getErp(nav.erp, time + dt);
 
 		FrameSwapper frameSwapper(time + dt, erpv);
-
-		frameSwapper.setCache(dt);
 	}
 
 	//try to get svns & block types of all used satellites
@@ -396,19 +405,11 @@ void mainOncePerEpoch(
 
 	//do per-station pre processing
 	bool emptyEpoch = true;
-#	ifdef ENABLE_PARALLELISATION
-		Eigen::setNbThreads(1);
-#		pragma omp parallel for
-#	endif
-	for (int i = 0; i < receiverMap.size(); i++)
+	parallelForEach(receiverMap, [&](auto& recEntry)
 	{
-		auto rec_ptr_iterator = receiverMap.begin();
-		std::advance(rec_ptr_iterator, i);
-
-		auto& [id, rec] = *rec_ptr_iterator;
+		auto& [id, rec] = recEntry;
 		mainOncePerEpochPerStation(rec, pppNet, emptyEpoch, remoteState);
-	}
-	Eigen::setNbThreads(0);
+	});
 
 
 	if	(emptyEpoch)
@@ -422,12 +423,21 @@ void mainOncePerEpoch(
 		ppp(pppTrace, receiverMap, pppNet.kfState, remoteState);
 	}
 
-	KFState* kfState_ptr;
+	//ambiguity resolution in the outputs modifies the state it is given, only copy the main state if that would be unwanted
+	bool perEpochAR	=	acsConfig.process_ppp
+					&&	acsConfig.ambrOpts.mode != +E_ARmode::OFF
+					&&	acsConfig.ambrOpts.once_per_epoch;
+
+	KFState* kfState_ptr = &pppNet.kfState;
 
 	KFState tempKfState;
 
-	if (acsConfig.ambrOpts.fix_and_hold)	{									kfState_ptr = &pppNet.kfState;		}
-	else									{	tempKfState = pppNet.kfState;	kfState_ptr = &tempKfState;		}
+	if	(  perEpochAR
+		&& acsConfig.ambrOpts.fix_and_hold == false)
+	{
+		tempKfState = pppNet.kfState;
+		kfState_ptr = &tempKfState;
+	}
 
 	auto& kfState = *kfState_ptr;
 
@@ -551,6 +561,8 @@ void mainPostProcessing(
 			satNav.satPos0.posTime = GTime::noTime();
 		}
 
+		clearPreciseArcs(nav);
+
 		if (acsConfig.process_ppp)
 		{
 			rtsSmoothing(pppNet.kfState, receiverMap, true);
@@ -900,10 +912,18 @@ int main(
 		//get observations from streams (allow some delay between stations, and retry, to ensure all messages for the epoch have arrived)
 		map<string, bool>	dataAvailableMap;
 		bool				repeat		= true;
+		bool				wait		= false;
 		while	( repeat
 				&&system_clock::now() < breakTime)
 		{
-			repeat = false;
+			if (wait)
+			{
+				//back off once per pass over all streams, rather than once per waiting stream
+				sleep_for(std::chrono::milliseconds(acsConfig.sleep_milliseconds));
+			}
+
+			repeat	= false;
+			wait	= false;
 
 			//load any changes from the config
 			bool newConfig = acsConfig.parse();
@@ -946,17 +966,13 @@ int main(
 					continue;
 				}
 
-				try
+				auto obsStream_ptr = dynamic_cast<ObsStream*>(streamParser_ptr.get());
+				if	(  obsStream_ptr
+					&& obsStream_ptr->hasObs())
 				{
-					auto& obsStream	= dynamic_cast<ObsStream&>(*streamParser_ptr);
-
-					if (obsStream.hasObs())
-					{
-						iter++;
-						continue;
-					}
+					iter++;
+					continue;
 				}
-				catch(...){}
 
 				if (stream.isDead())
 				{
@@ -995,32 +1011,35 @@ int main(
 				break;
 			}
 
-			//parse all non-observation streams
-			for (auto& [id, streamParser_ptr] : streamParserMultimap)
-			try
-			{
-				auto& obsStream = dynamic_cast<ObsStream&>(*streamParser_ptr);
-			}
-			catch (std::bad_cast& e)
-			{
-				streamParser_ptr->parse();
-			}
-
-
+			BenchmarkTimer benchmarkTimer("inputs");
 
+			//parse all non-observation streams, and collect the observation streams for later
+			vector<pair<string, ObsStream*>> obsStreamList;
 			for (auto& [id, streamParser_ptr] : streamParserMultimap)
 			{
-				ObsStream* obsStream_ptr;
-
-				try
-				{
-					obsStream_ptr = &dynamic_cast<ObsStream&>(*streamParser_ptr);
-				}
-				catch (std::bad_cast& e)
+				auto obsStream_ptr = dynamic_cast<ObsStream*>(streamParser_ptr.get());
+				if (obsStream_ptr == nullptr)
 				{
+					streamParser_ptr->parse();
 					continue;
 				}
 
+				obsStreamList.push_back({id, obsStream_ptr});
+			}
+
+			//parse ahead on any observation streams that may be decoded independently of the others
+#			ifdef ENABLE_PARALLELISATION
+#				pragma omp parallel for
+#			endif
+			for (int i = 0; i < obsStreamList.size(); i++)
+			{
+				auto& [id, obsStream_ptr] = obsStreamList[i];
+
+				obsStream_ptr->prefetch();
+			}
+
+			for (auto& [id, obsStream_ptr] : obsStreamList)
+			{
 				auto& obsStream = *obsStream_ptr;
 
 				auto& recOpts = acsConfig.getRecOpts(id);
@@ -1066,8 +1085,8 @@ int main(
 					if (obsStream.obsWaitCode == +E_ObsWaitCode::NO_DATA_WAIT)
 					{
 						// try again later
-						repeat = true;
-						sleep_for(std::chrono::milliseconds(acsConfig.sleep_milliseconds));
+						repeat	= true;
+						wait	= true;
 					}
 
 					continue;
@@ -1144,6 +1163,8 @@ int main(
 		if	( acsConfig.require_obs		== false
 			||dataAvailableMap.empty()	== false)
 		{
+			BenchmarkTimer benchmarkTimer("epoch");
+
 			mainOncePerEpoch(pppNet, ionNet, receiverMap, tsync);
 		}
 		lastEpochStopTime	= timeGet();
@@ -1177,7 +1198,13 @@ int main(
 	<< "\n"
 	<< "Finalising streams and post processing...";
 
-	mainPostProcessing(pppNet, ionNet, receiverMap);
+	{
+		BenchmarkTimer benchmarkTimer("postProcessing");
+
+		mainPostProcessing(pppNet, ionNet, receiverMap);
+	}
+
+	outputBenchmark(acsConfig.benchmark_filename, epoch);
 
 	GTime peaStopTime = timeGet();
 	BOOST_LOG_TRIVIAL(info)
@@ -168,10 +168,9 @@ void minOrbitData(
 	}
 }
 
-void zeroAndPush(int index, MatrixXd& R, KFState& kfStateTrans, KFMeasEntryList& measList)
+void zeroAndPush(int index, vector<bool>& keptList, KFState& kfStateTrans, KFMeasEntryList& measList)
 {
-	R.row(index).setZero();
-	R.col(index).setZero();
+	keptList[index] = false;
 
 	// Add null measurement and continue, it's needed for inverse later
 	KFMeasEntry meas(&kfStateTrans);
@@ -220,7 +219,9 @@ void mincon(
 	InitialState scaleInit = initialStateFromConfig(acsConfig.minconOpts.scale);
 	InitialState delayInit = initialStateFromConfig(acsConfig.minconOpts.delay);
 
-	MatrixXd R = kfStateStations.P;
+	//track which states contribute to the noise matrix, rather than copying and then zeroing most of the full covariance matrix
+	vector	<bool>					keptList(kfStateStations.x.rows(), true);
+	map		<int, Matrix3d>			noiseBlockMap;
 
 	vector	<int>		indices;
 	map		<int, bool>	usedMap;
@@ -246,7 +247,7 @@ void mincon(
 
 		if (key.type != KF::REC_POS && key.type != KF::ORBIT)
 		{
-			zeroAndPush(index, R, kfStateTrans, measList);
+			zeroAndPush(index, keptList, kfStateTrans, measList);
 			continue;
 		}
 
@@ -254,7 +255,7 @@ void mincon(
 			&&( key.num >= 3
 			  ||acsConfig.minconOpts.constrain_orbits == false))
 		{
-			zeroAndPush(index, R, kfStateTrans, measList);
+			zeroAndPush(index, keptList, kfStateTrans, measList);
 			continue;
 		}
 
@@ -289,7 +290,7 @@ void mincon(
 
 			if (satNav.aprioriPos.isZero())
 			{
-				zeroAndPush(index, R, kfStateTrans, measList);
+				zeroAndPush(index, keptList, kfStateTrans, measList);
 				continue;
 			}
 
@@ -310,15 +311,14 @@ void mincon(
 		if	( aprioriVar(0,0) <= 0
 			&&acsConfig.minconOpts.transform_unweighted == false)
 		{
-			zeroAndPush(index, R, kfStateTrans, measList);
+			zeroAndPush(index, keptList, kfStateTrans, measList);
 			continue;
 		}
 
 		if	( aprioriVar(0,0) <= 0
 			||aprioriPos.isZero())
 		{
-			R.row(index).setZero();
-			R.col(index).setZero();
+			keptList[index] = false;
 
 			used = false;
 		}
@@ -383,14 +383,14 @@ void mincon(
 
 		if (acsConfig.minconOpts.full_vcv == false)
 		{
-			R.middleRows(index, 3).setZero();
-			R.middleCols(index, 3).setZero();
+			for (int i = 0; i < 3; i++)
+				keptList[index + i] = false;
 		}
 
 		if	(  acsConfig.minconOpts.full_vcv == false
 			&& used)
 		{
-			R.block(index, index, 3, 3) = noise;
+			noiseBlockMap[index] = noise;
 		}
 
 		for (short xyz = 0; xyz < 3; xyz++)
@@ -451,6 +451,23 @@ void mincon(
 	//use a state transition to initialise elements
 	kfStateTrans.stateTransition(trace, kfStateStations.time);
 
+	//assemble the noise matrix from the kept subset of the filter covariance and any replacement noise blocks
+	vector<int> keptIndices;
+	for (int i = 0; i < keptList.size(); i++)
+	{
+		if (keptList[i])
+			keptIndices.push_back(i);
+	}
+
+	MatrixXd R = MatrixXd::Zero(kfStateStations.x.rows(), kfStateStations.x.rows());
+
+	R(keptIndices, keptIndices) = kfStateStations.P(keptIndices, keptIndices);
+
+	for (auto& [index, noise] : noiseBlockMap)
+	{
+		R.block(index, index, 3, 3) = noise;
+	}
+
 // 	std::cout << "\n" << "R" << "\n" << R << "\n";
 
 	MatrixXd RR = R(indices, indices);
@@ -492,9 +509,11 @@ void mincon(
 	KFState oldStateStations = kfStateStations;
 
 	//Do kalman filter on original state using pseudomeasurements
+	//the design matrices only touch a small subset of states, so products are formed with H.P (and its transpose P.Ht) rather than with the full H and P
 	MatrixXd K;
 	VectorXd v;
 	MatrixXd H;
+	MatrixXd HP;
 
 	auto& P = kfStateStations.P;
 
@@ -528,13 +547,14 @@ void mincon(
 			//standard kalman filter stuff using the ordinary states
 			//filter using pseudoobs for each position state
 
-			//design matrix is subset of identity matrix
-			H	= MatrixXd::Identity(kfStateStations.x.rows(), kfStateStations.x.rows());
-			H	= H(posIndices, all).eval();
+			//design matrix is subset of identity matrix, so H.P is just the position rows of P
+			HP	= P(posIndices, all);
 
 
 			//calculate kalman gain
-			K = P * H.transpose() * (H * P * H.transpose() + Omega).inverse();
+			MatrixXd HPHt = HP(all, posIndices);
+
+			K = HP.transpose() * (HPHt + Omega).inverse();
 
 			//do some algebra to compute the required v values such that a subset of kalman state adjustments are the desired dx calculated previously
 			//ie, find v
@@ -544,16 +564,17 @@ void mincon(
 
 			// solve A.x = b, where:
 			// x = v
-			auto A = K.transpose() * H.transpose() * H * K;
-			auto b = K.transpose() * H.transpose() * tTheta;
+			MatrixXd HK = K(posIndices, all);
+
+			auto A = HK.transpose() * HK;
+			auto b = HK.transpose() * tTheta;
 
 			v = A.ldlt().solve(b);
 
 			if (0)
 			{
-				VectorXd errors = tTheta - H * K * v;
+				VectorXd errors = tTheta - HK * v;
 				std::cout << "\n" << "tTheta:"	<< "\n" << tTheta	<< "\n";
-				std::cout << "\n" << "H:"		<< "\n" << H		<< "\n";
 				std::cout << "\n" << "errors:"	<< "\n" << errors	<< "\n";
 			}
 			break;
@@ -663,7 +684,9 @@ void mincon(
 // 			std::cout << "\n" << "TDash" << "\n" << H << "\n";
 
 			//calculate kalman gain
-			K = P * H.transpose() * (H * P * H.transpose()/* + Omega*/).inverse();
+			HP = H * P;
+
+			K = HP.transpose() * (HP * H.transpose()/* + Omega*/).inverse();
 
 			break;
 		}
@@ -685,7 +708,7 @@ void mincon(
 
 		kfState.dx	= (K * v					).eval();
 		kfState.x	= (kfState.x - kfState.dx	).eval();
-		kfState.P	= (kfState.P - K * H * P	).eval();
+		kfState.P	= (kfState.P - K * HP		).eval();
 
 		if (isPositiveSemiDefinite(P) == false)
 		{
@@ -31,6 +31,7 @@ using std::this_thread::sleep_for;
 #include "rinexObsWrite.hpp"
 #include "rinexClkWrite.hpp"
 #include "algebraTrace.hpp"
+#include "benchmark.hpp"
 #include "rtsSmoothing.hpp"
 #include "streamCustom.hpp"
 #include "streamParser.hpp"
@@ -714,6 +715,8 @@ void perEpochPostProcessingAndOutputs(
 	const GTime&	time,
 	bool			emptyEpoch)
 {
+	BenchmarkTimer benchmarkTimer("outputs");
+
 	InteractiveTerminal::setMode(E_InteractiveMode::Outputs);
 
 	auto ionTrace = getTraceFile(ionNet);
@@ -763,7 +766,19 @@ void perEpochPostProcessingAndOutputs(
 		}
 	}
 
-	KFState tempAugmentedKF = kfState;
+	//minimum constraints modify the state they are given, only copy the state if they will be applied
+	KFState constrainedKF;
+	KFState* augmentedKF_ptr = &kfState;
+
+	if	(  acsConfig.process_ppp
+		&& acsConfig.process_minimum_constraints
+		&& acsConfig.minconOpts.once_per_epoch)
+	{
+		constrainedKF	= kfState;
+		augmentedKF_ptr	= &constrainedKF;
+	}
+
+	auto& tempAugmentedKF = *augmentedKF_ptr;
 
 	if (acsConfig.process_ppp)
 	{
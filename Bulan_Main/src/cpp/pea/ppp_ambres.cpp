@@ -15,6 +15,7 @@
 
 #include "eigenIncluder.hpp"
 #include "GNSSambres.hpp"
+#include "benchmark.hpp"
 #include "acsConfig.hpp"
 #include "algebra.hpp"
 #include "biases.hpp"
@@ -116,6 +117,14 @@ void applyUCAmbiguities(
 	MatrixXd Z		= mtrx.Ztrs;
 	VectorXd zfix	= mtrx.zfix;
 
+	//keys in index order, the filter is unchanged since the float values were extracted so those may be used directly
+	vector<KFKey> ambKeys;
+	ambKeys.reserve(nx);
+	for (auto& [j, key] : mtrx.ambmap)
+	{
+		ambKeys.push_back(key);
+	}
+
 	if (AR_VERBO)
 	{
 		trace << "\n" << "zfix =" << "\n" << zfix.transpose()	<< "\n";
@@ -144,10 +153,9 @@ void applyUCAmbiguities(
 				continue;
 			}
 
-			double ambiguity = 0;
+			auto& key = ambKeys[j];
 
-			KFKey key = mtrx.ambmap[j];
-			kfState.getKFValue(key, ambiguity);
+			double ambiguity = mtrx.aflt(j);
 
 			residual -= Z(i,j) * ambiguity;
 
@@ -157,7 +165,7 @@ void applyUCAmbiguities(
 			init.x = ambiguity;
 			init.P = 3600;
 
-			measEntry.addDsgnEntry(mtrx.ambmap[j], Z(i,j), init);
+			measEntry.addDsgnEntry(key, Z(i,j), init);
 		}
 
 		tracepdeex(4, trace, "= %+10.5f\n", zfix(i));
@@ -180,6 +188,8 @@ void fixAndHoldAmbiguities(
 {
 	tracepdeex(3, trace, "%s: %s\n", __FUNCTION__, kfState.time.to_string().c_str());
 
+	BenchmarkTimer benchmarkTimer("ambiguityResolution");
+
 	if (acsConfig.ambrOpts.mode == +E_ARmode::OFF)
 	{
 		return;
@@ -191,6 +201,8 @@ void fixAndHoldAmbiguities(
 
 	int ind = 0;
 	vector<int> indices;
+	map<E_Sys, vector<int>> sysGroupMap;
+	indices.reserve(kfState.kfIndexMap.size());
 	for (auto& [key, index] : kfState.kfIndexMap)
 	{
 		if (key.type != KF::AMBIGUITY)
@@ -205,6 +217,8 @@ void fixAndHoldAmbiguities(
 
 		indices.push_back(index);
 
+		sysGroupMap[key.Sat.sys].push_back(ind);
+
 		ARmtx.ambmap[ind] = key;
 		ind++;
 	}
@@ -226,7 +240,22 @@ void fixAndHoldAmbiguities(
 		AR_VERBO = true;
 
 	// Resolve and apply ambiguities
-	int nfix = GNSS_AR(trace, ARmtx, ARopt);
+	int nfix;
+	if	(  acsConfig.ambrOpts.resolve_by_system
+		&& sysGroupMap.size() > 1)
+	{
+		vector<vector<int>> groupList;
+		for (auto& [sys, group] : sysGroupMap)
+		{
+			groupList.push_back(group);
+		}
+
+		nfix = GNSS_AR(trace, ARmtx, ARopt, groupList);
+	}
+	else
+	{
+		nfix = GNSS_AR(trace, ARmtx, ARopt);
+	}
 	if (nfix > 0)
 	{
 		applyUCAmbiguities(trace, kfState, ARmtx);
@@ -24,6 +24,7 @@ using std::ostringstream;
 #include "interactiveTerminal.hpp"
 #include "eigenIncluder.hpp"
 #include "coordinates.hpp"
+#include "benchmark.hpp"
 #include "geomagField.hpp"
 #include "tropModels.hpp"
 #include "acsConfig.hpp"
@@ -416,7 +417,7 @@ inline static void pppRecPCO(COMMON_PPP_ARGS)
 	if (initialStateFromConfig(recOpts.orientation).estimate)
 		dEdQ = MatrixXd::Zero(3,4);
 
-	Vector3d bodyPCO	= antPco(rec.antennaId, Sat.sys, recAtxFt, time, variance, E_Radio::RECEIVER, acsConfig.interpolate_rec_pco);
+	Vector3d bodyPCO	= antPco(rec.antennaId, Sat.sys, recAtxFt, time, variance, E_Radio::RECEIVER, acsConfig.interpolate_rec_pco, &rec.antennaHandle);
 	Vector3d bodyLook	= ecef2body(attStatus, satStat.e, &dEdQ);	//todo aaron, move this to antDelta instead
 
 	for (int i = 0; i < 3; i++)
@@ -486,7 +487,7 @@ inline static void pppSatPCO(COMMON_PPP_ARGS)
 
 	double variance = 0;
 
-	Vector3d bodyPCO	= antPco(Sat.id(), Sat.sys, satAtxFt, time, variance, E_Radio::TRANSMITTER);
+	Vector3d bodyPCO	= antPco(Sat.id(), Sat.sys, satAtxFt, time, variance, E_Radio::TRANSMITTER, false, &satNav.antennaHandle);
 	Vector3d bodyLook	= ecef2body(attStatus, satStat.e);
 
 	for (int i = 0; i < 3; i++)
@@ -556,7 +557,7 @@ inline static void pppRecPCV(COMMON_PPP_ARGS)
 
 	double az	= 0;
 	double zen	= 0;
-	double recPCVDelta = antPcv(rec.antennaId,	Sat.sys, recAtxFt, time, rec.attStatus,		satStat.e * +1, &az, &zen);
+	double recPCVDelta = antPcv(rec.antennaId,	Sat.sys, recAtxFt, time, rec.attStatus,		satStat.e * +1, &az,		&zen,		&rec.antennaHandle);
 
 	InitialState init = initialStateFromConfig(recOpts.pcv);
 
@@ -614,7 +615,7 @@ inline static void pppSatPCV(COMMON_PPP_ARGS)
 		else								satAtxFt = F1;
 	}
 
-	double satPCVDelta = antPcv(Sat.id(),		Sat.sys, satAtxFt, time, satNav.attStatus,	satStat.e * -1);
+	double satPCVDelta = antPcv(Sat.id(),		Sat.sys, satAtxFt, time, satNav.attStatus,	satStat.e * -1, nullptr,	nullptr,	&satNav.antennaHandle);
 
 	measEntry.componentsMap[E_Component::SAT_PCV] = {satPCVDelta, "+ PCV_s", 0};
 }
@@ -923,9 +924,11 @@ inline static void pppIonModel(COMMON_PPP_ARGS)
 
 		tracepdeex(0, trace, "\n Iono Model : %.4f, %.4f     %s", obs.ippMap[0].latDeg , obs.ippMap[0].lonDeg, Sat.id());
 
+		VectorXd coeffs = ionModelCoefs(trace, obs);
+
 		for (int i = 0; i < acsConfig.ionModelOpts.numBasis; i++)
 		{
-			double coeff = ionModelCoef(trace, i, obs);
+			double coeff = coeffs(i);
 
 			if (coeff == 0)
 				continue;
@@ -1498,6 +1501,8 @@ void receiverUducGnss(
 {
 	DOCS_REFERENCE(UDUC_GNSS_Measurements__);
 
+	BenchmarkTimer benchmarkTimer("receiverUducGnss");
+
 	auto trace		= getTraceFile(rec);
 	auto jsonTrace	= getTraceFile(rec, true);
 
@@ -62,6 +62,7 @@ using std::map;
 #include "ionoModel.hpp"
 #include "acsConfig.hpp"
 #include "metaData.hpp"
+#include "parallel.hpp"
 #include "receiver.hpp"
 #include "posProp.hpp"
 #include "algebra.hpp"
@@ -1302,29 +1303,21 @@ void ppp(
 		BOOST_LOG_TRIVIAL(info) << " ------- CALCULATING PPP MEASUREMENTS --------" << "\n";
 
 		//calculate the measurements for each station
-#		ifdef ENABLE_PARALLELISATION
-			Eigen::setNbThreads(1);
-#			pragma omp parallel for
-#		endif
-		for (int i = 0; i < receiverMap.size(); i++)
+		parallelForEach(receiverMap, [&](auto& recEntry)
 		{
-			auto rec_iterator = receiverMap.begin();
-			std::advance(rec_iterator, i);
-
-			auto& [id, rec] = *rec_iterator;
+			auto& [id, rec] = recEntry;
 
 			if	( 0
 				// rec.ready == false
 				||rec.obsList.empty())
 			{
-				continue;
+				return;
 			}
 
 			auto& kfMeasEntryList = stationKFEntryListMap[rec.id];
 
 			perRecMeasurements(trace, rec, receiverMap, kfMeasEntryList, kfState, remoteState);
-		}
-		Eigen::setNbThreads(0);
+		});
 	}
 
 	//combine all lists of measurements into a single list
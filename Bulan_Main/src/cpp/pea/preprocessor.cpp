@@ -20,6 +20,7 @@ Architecture Preprocessing__()
 
 #include "observations.hpp"
 #include "navigation.hpp"
+#include "benchmark.hpp"
 #include "GNSSambres.hpp"
 #include "testUtils.hpp"
 #include "acsConfig.hpp"
@@ -168,6 +169,8 @@ void preprocessor(
 {
 	DOCS_REFERENCE(Preprocessing__);
 
+	BenchmarkTimer benchmarkTimer("preprocessor");
+
 	if	( (acsConfig.process_preprocessor == false)
 		||(acsConfig.preprocOpts.preprocess_all_data == true	&& realEpoch == true)
 		||(acsConfig.preprocOpts.preprocess_all_data == false	&& realEpoch == false))
@@ -143,6 +143,30 @@ bool prange(
 	return true;
 }
 
+/** Pseudorange of an observation with code bias corrections applied, which is independent of the receiver position
+*/
+struct SppRange
+{
+	bool	pass	= false;	///< Pseudorange could be calculated
+	double	range	= 0;		///< Pseudorange value
+	double	vMeas	= 0;		///< Pseudorange variance
+	double	vBias	= 0;		///< Bias variance
+};
+
+/** Pseudoranges of the observations of an epoch, calculated once and shared by all SPP iterations and RAIM candidates
+*/
+struct SppRangeMap : map<SatSys, SppRange>
+{
+
+};
+
+/** Geometry of a satellite that is overwritten by each SPP solution
+*/
+struct SppGeometry : AzEl
+{
+	VectorEcef	e;			///< Line-of-sight unit vector
+};
+
 /** Compute ionospheric corrections
 */
 bool ionocorr(
@@ -355,15 +379,24 @@ void removeUnmeasuredStates(
 /** Estimate receiver position and biases using code measurements
 */
 E_Solution estpos(
-	Trace&		trace,					///< Trace file to output to
-	ObsList&	obsList,				///< List of observations for this epoch
-	Solution&	sol,					///< Solution object containing initial conditions and results
-	string		id,						///< Id of receiver
-	KFState*	kfState_ptr = nullptr,	///< Optional kfstate pointer to retrieve ppp values from
-	string		description = "SPP")	///< Description to prepend to clarify outputs
+	Trace&			trace,						///< Trace file to output to
+	ObsList&		obsList,					///< List of observations for this epoch
+	Solution&		sol,						///< Solution object containing initial conditions and results
+	string			id,							///< Id of receiver
+	KFState*		kfState_ptr		= nullptr,	///< Optional kfstate pointer to retrieve ppp values from
+	string			description		= "SPP",	///< Description to prepend to clarify outputs
+	SppRangeMap*	rangeMap_ptr	= nullptr)	///< Optional pseudoranges already calculated for these observations
 {
 	int numMeas = 0;
 
+	SppRangeMap	localRangeMap;
+	if (rangeMap_ptr == nullptr)
+	{
+		rangeMap_ptr = &localRangeMap;
+	}
+
+	auto& rangeMap = *rangeMap_ptr;
+
 	if (obsList.empty())
 	{
 		return E_Solution::NONE;
@@ -449,11 +482,21 @@ E_Solution estpos(
 			double r = geodist(rSat, rRec, satStat.e);
 			int debuglvl = 2;
 
-			// psudorange with code bias correction
-			double range;
-			double vMeas;
-			double vBias;
-			int pass = prange(trace, obs, acsConfig.sppOpts.iono_mode, range, vMeas, vBias, kfState_ptr);
+			// psudorange with code bias correction, independent of position so only calculated once
+			auto rangeIt = rangeMap.find(obs.Sat);
+			if (rangeIt == rangeMap.end())
+			{
+				SppRange sppRange;
+				sppRange.pass = prange(trace, obs, acsConfig.sppOpts.iono_mode, sppRange.range, sppRange.vMeas, sppRange.vBias, kfState_ptr);
+
+				rangeIt = rangeMap.insert({obs.Sat, sppRange}).first;
+			}
+
+			auto&	sppRange	= rangeIt->second;
+			double	range		= sppRange.range;
+			double	vMeas		= sppRange.vMeas;
+			double	vBias		= sppRange.vBias;
+			int		pass		= sppRange.pass;
 			if (pass == false)
 			{
 				obs.failurePrange = true;
@@ -714,21 +757,29 @@ E_Solution estpos(
 /** Receiver autonomous integrity monitoring (RAIM) failure detection and exclution
 */
 bool raim(
-	Trace&		trace,		///< Trace file to output to
-	ObsList&	obsList,	///< List of observations for this epoch
-	Solution&	sol,		///< Solution object containing initial conditions and results
-	string		id,			///< Id of receiver
-	KFState*	kfState_ptr = nullptr)
+	Trace&			trace,						///< Trace file to output to
+	ObsList&		obsList,					///< List of observations for this epoch
+	Solution&		sol,						///< Solution object containing initial conditions and results
+	string			id,							///< Id of receiver
+	KFState*		kfState_ptr		= nullptr,	///< Optional kfstate pointer to retrieve ppp values from
+	SppRangeMap*	rangeMap_ptr	= nullptr)	///< Optional pseudoranges already calculated for these observations
 {
 	trace << "\n" << "Performing RAIM.";
 
 	SatSys exSat;
 	double bestRms = 100;
 
-	map<SatSys, SatStat> satStatBak;
-	map<SatSys, SatStat> satStatBest;
+	SppRangeMap	localRangeMap;
+	if (rangeMap_ptr == nullptr)
+	{
+		rangeMap_ptr = &localRangeMap;
+	}
+
+	map<SatSys, SppGeometry> satStatBak;
+	map<SatSys, SppGeometry> satStatBest;
 
-	auto backupSatStats = [&](map<SatSys, SatStat>& dest, bool backup)
+	//only the geometry of the satStats is modified by estpos, save and restore that rather than the entire objects
+	auto backupSatStats = [&](map<SatSys, SppGeometry>& dest, bool backup)
 	{
 		for (auto& obs : only<GObs>(obsList))
 		{
@@ -737,8 +788,20 @@ bool raim(
 				continue;
 			}
 
-			if (backup)		dest[obs.Sat]		= *obs.satStat_ptr;
-			else			*obs.satStat_ptr	= dest[obs.Sat];
+			auto& satStat = *obs.satStat_ptr;
+
+			if (backup)
+			{
+				auto& geometry = dest[obs.Sat];
+				(AzEl&) geometry	= satStat;
+				geometry.e			= satStat.e;
+			}
+			else
+			{
+				auto& geometry = dest[obs.Sat];
+				(AzEl&) satStat		= geometry;
+				satStat.e			= geometry.e;
+			}
 		}
 	};
 
@@ -751,8 +814,6 @@ bool raim(
 			continue;
 		}
 
-		map<SatSys, SatStat> satStatBak;
-
 		backupSatStats(satStatBak, false);
 
 		ObsList testList;
@@ -772,7 +833,7 @@ bool raim(
 		sol_e.sppState = KFState();
 
 		//try to get position using test subset of all observations
-		E_Solution status = estpos(trace, testList, sol_e, id, kfState_ptr, (string)"RAIM/" + id + "/" + testObs.Sat.id());
+		E_Solution status = estpos(trace, testList, sol_e, id, kfState_ptr, (string)"RAIM/" + id + "/" + testObs.Sat.id(), rangeMap_ptr);
 		if (status != +E_Solution::SINGLE)
 		{
 			continue;
@@ -875,8 +936,10 @@ void spp(
 
 	tracepdeex(3,trace,	"\n%s  : tobs=%s n=%zu", __FUNCTION__, obsList.front()->time.to_string().c_str(), obsList.size());
 
+	SppRangeMap rangeMap;
+
 	//estimate receiver position with pseudorange
-	sol.status = estpos(trace, obsList, sol, id, kfState_ptr, (string) "SPP/" + id);	//todo aaron, remote too?
+	sol.status = estpos(trace, obsList, sol, id, kfState_ptr, (string) "SPP/" + id, &rangeMap);	//todo aaron, remote too?
 
 	if (sol.status != +E_Solution::SINGLE)
 	{
@@ -886,7 +949,7 @@ void spp(
 		if	( sol.numMeas >= 6		//need 6 so that 6-1 is still overconstrained, otherwise they all pass equally.
 			&&acsConfig.sppOpts.raim)
 		{
-			raim(trace, obsList, sol, id);
+			raim(trace, obsList, sol, id, nullptr, &rangeMap);
 		}
 	}
 
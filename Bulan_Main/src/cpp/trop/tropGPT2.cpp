@@ -2,10 +2,16 @@
 #include <fstream>
 #include <cstring>
 #include <math.h>
+#include <memory>
 #include <array>
+#include <mutex>
 
+using std::make_shared;
+using std::lock_guard;
+using std::shared_ptr;
 using std::ifstream;
 using std::array;
+using std::mutex;
 
 
 #include "tropModels.hpp"
@@ -37,8 +43,31 @@ struct GptGrid
 	double			hgt		= 0;		///< orthometric height (m)
 };
 
-vector<GptGrid>		globalGPT2Grids			= {};		///< gpt grid information
-bool				globalGPT2GridsReady	= false;	///< gpt grid information read
+/** gpt grid point with the seasonal terms evaluated at a particular epoch
+ */
+struct GptEpochPoint
+{
+	double	pres	= 0;		///< pressure										(pascal)
+	double	temp	= 0;		///< temperature									(kelvin)
+	double	humid	= 0;		///< humidity										(kg/kg)
+	double	tlaps	= 0;		///< elapse rate									(kelvin/m)
+	double	ah		= 0;		///< hydrostatic	mapping function coefficient
+	double	aw		= 0;		///< wet			mapping function coefficient
+};
+
+/** whole gpt grid evaluated at a particular day, shared by all stations processed on that day
+ */
+struct GptEpochGrid
+{
+	const vector<GptGrid>*	gptg_ptr	= nullptr;		///< grid that the points were evaluated from
+	double					mjdDay		= 0;			///< whole modified julian day that the points were evaluated for
+	vector<GptEpochPoint>	pointList;
+};
+
+vector<GptGrid>					globalGPT2Grids			= {};		///< gpt grid information
+bool							globalGPT2GridsReady	= false;	///< gpt grid information read
+shared_ptr<const GptEpochGrid>	globalGPT2EpochGrid_ptr;			///< gpt grid information evaluated for the most recent day
+mutex							globalGPT2EpochGridMutex;			///< serialises rebuilding of the evaluated grid
 
 
 /* sign function ---------------------------------------------------------------
@@ -191,17 +220,49 @@ double coefr(
 			+ l1 * r[1];
 }
 
-/** global pressure and temperature
+/** Check whether an evaluated grid may be used for a grid and day
  */
-GPTVals gpt2(
+bool gpt2EpochGridValid(
+	const shared_ptr<const GptEpochGrid>&	epochGrid_ptr,	///< evaluated grid to check
+	const vector<GptGrid>&					gptg,			///< gpt grid information
+	double									mjdDay)			///< whole modified julian day
+{
+	return	(  epochGrid_ptr
+			&& epochGrid_ptr->gptg_ptr				== &gptg
+			&& epochGrid_ptr->mjdDay				== mjdDay
+			&& epochGrid_ptr->pointList.size()		== gptg.size());
+}
+
+/** Get the gpt grid evaluated for the day of an epoch, evaluating the seasonal terms of all points if it has not been done already.
+ * The seasonal terms have periods of a year and half a year, so they are evaluated at midday of each day rather than at every epoch,
+ * which lets receivers with slightly different time tags share the grid.
+ * Only one thread rebuilds the grid, others wait for and reuse its result.
+ */
+shared_ptr<const GptEpochGrid> gpt2EpochGrid(
 	const vector<GptGrid>&		gptg,		///< gpt grid information
-	double						mjd,		///< modified julian date
-	double						lat,		///< ellipsoidal lat (rad)
-	double						lon,		///< ellipsoidal lon (rad)
-	double						hell)		///< ellipsoidal height (m)
+	double						mjd)		///< modified julian date
 {
+	double mjdDay = floor(mjd);
+
+	auto epochGrid_ptr = std::atomic_load(&globalGPT2EpochGrid_ptr);
+
+	if (gpt2EpochGridValid(epochGrid_ptr, gptg, mjdDay))
+	{
+		return epochGrid_ptr;
+	}
+
+	lock_guard<mutex> guard(globalGPT2EpochGridMutex);
+
+	/* another thread may have rebuilt it while waiting for the lock */
+	epochGrid_ptr = std::atomic_load(&globalGPT2EpochGrid_ptr);
+
+	if (gpt2EpochGridValid(epochGrid_ptr, gptg, mjdDay))
+	{
+		return epochGrid_ptr;
+	}
+
 	/* change reference epoch to 1/1/2000 */
-	double mjd1 = mjd - MJD_j2000;
+	double mjd1 = mjdDay + 0.5 - MJD_j2000;
 
 	/* factors for amplitudes */
 	double cosfy = cos(mjd1 / 365.25 * 2 * PI);
@@ -209,6 +270,46 @@ GPTVals gpt2(
 	double sinfy = sin(mjd1 / 365.25 * 2 * PI);
 	double sinhy = sin(mjd1 / 365.25 * 4 * PI);
 
+	auto newGrid_ptr = make_shared<GptEpochGrid>();
+	auto& newGrid = *newGrid_ptr;
+
+	newGrid.gptg_ptr	= &gptg;
+	newGrid.mjdDay		= mjdDay;
+	newGrid.pointList.resize(gptg.size());
+
+	for (int i = 0; i < gptg.size(); i++)
+	{
+		auto& gptGridPoint	= gptg[i];
+		auto& epochPoint	= newGrid.pointList[i];
+
+		epochPoint.pres		= coef(gptGridPoint.pres,	cosfy, sinfy, coshy, sinhy);
+		epochPoint.temp		= coef(gptGridPoint.temp,	cosfy, sinfy, coshy, sinhy);
+		epochPoint.humid	= coef(gptGridPoint.humid,	cosfy, sinfy, coshy, sinhy);
+		epochPoint.tlaps	= coef(gptGridPoint.tlaps,	cosfy, sinfy, coshy, sinhy);
+		epochPoint.ah		= coef(gptGridPoint.ah,		cosfy, sinfy, coshy, sinhy);
+		epochPoint.aw		= coef(gptGridPoint.aw,		cosfy, sinfy, coshy, sinhy);
+	}
+
+	shared_ptr<const GptEpochGrid> constGrid_ptr = newGrid_ptr;
+
+	std::atomic_store(&globalGPT2EpochGrid_ptr, constGrid_ptr);
+
+	return constGrid_ptr;
+}
+
+/** global pressure and temperature
+ */
+GPTVals gpt2(
+	const vector<GptGrid>&		gptg,		///< gpt grid information
+	double						mjd,		///< modified julian date
+	double						lat,		///< ellipsoidal lat (rad)
+	double						lon,		///< ellipsoidal lon (rad)
+	double						hell)		///< ellipsoidal height (m)
+{
+	/* seasonal terms of all grid points, evaluated once per day */
+	auto epochGrid_ptr = gpt2EpochGrid(gptg, mjd);
+	auto& epochPoints = epochGrid_ptr->pointList;
+
 	/* positive longitude in degrees */
 	double plon;
 	if (lon < 0)	plon = (lon+2*PI)	* 180 / PI;
@@ -246,17 +347,18 @@ GPTVals gpt2(
 		/* near the pole */
 		int i = index[0] - 1;
 
-		auto& gptGridPoint = gptg[i];
+		auto& gptGridPoint	= gptg[i];
+		auto& epochPoint	= epochPoints[i];
 
 		gptVals.undulation = gptGridPoint.undu;
 
 		double hgt = hell - gptVals.undulation;
 
 		/* pressure, temperature at the height of grid */
-		double t0	= coef(gptGridPoint.temp,	cosfy, sinfy, coshy, sinhy);
-		double p0	= coef(gptGridPoint.pres,	cosfy, sinfy, coshy, sinhy);
-		double q0	= coef(gptGridPoint.humid,	cosfy, sinfy, coshy, sinhy);
-		double dt0	= coef(gptGridPoint.tlaps,	cosfy, sinfy, coshy, sinhy);
+		double t0	= epochPoint.temp;
+		double p0	= epochPoint.pres;
+		double q0	= epochPoint.humid;
+		double dt0	= epochPoint.tlaps;
 
 		double con = GRAVITY * MOLARDRY / (UGAS * t0 * (1 + 0.6077 * q0));
 
@@ -271,8 +373,8 @@ GPTVals gpt2(
 		gptVals.waterVp		= (q0 * gptVals.pressure) / (0.622 + 0.378 * q0);
 
 		/* dry and wet coefficients */
-		gptVals.hydroCoef	= coef(gptGridPoint.ah, cosfy, sinfy, coshy, sinhy);
-		gptVals.wetCoef		= coef(gptGridPoint.aw, cosfy, sinfy, coshy, sinhy);
+		gptVals.hydroCoef	= epochPoint.ah;
+		gptVals.wetCoef		= epochPoint.aw;
 	}
 	else
 	{
@@ -297,25 +399,26 @@ GPTVals gpt2(
 
 		for (int k = 0; k < 4; k++)
 		{
-			auto& gptGridPointK = gptg[index[k]];
+			auto& gptGridPointK	= gptg[index[k]];
+			auto& epochPointK	= epochPoints[index[k]];
 
 			undu[k] = gptGridPointK.undu;
 
 			double hgt = hell - undu[k];
 
 			/* pressure, temperature at the height of the grid */
-			double t0		= coef(gptGridPointK.temp,	cosfy, sinfy, coshy, sinhy);
-			double p0		= coef(gptGridPointK.pres,	cosfy, sinfy, coshy, sinhy);
-			q[k]			= coef(gptGridPointK.humid,	cosfy, sinfy, coshy, sinhy);
-			dt[k]			= coef(gptGridPointK.tlaps,	cosfy, sinfy, coshy, sinhy);
+			double t0		= epochPointK.temp;
+			double p0		= epochPointK.pres;
+			q[k]			= epochPointK.humid;
+			dt[k]			= epochPointK.tlaps;
 
 			t[k] = t0 + dt[k] * (hgt - gptGridPointK.hgt) - ZEROC;
 			double con = GRAVITY * MOLARDRY / (UGAS * t0 * (1 + 0.6077 * q[k]));
 
 			p[k]	= (p0 * exp(-con * (hgt - gptGridPointK.hgt))) / 100;
 
-			ah[k]			= coef(gptGridPointK.ah,	cosfy, sinfy, coshy, sinhy);
-			aw[k]			= coef(gptGridPointK.aw,	cosfy, sinfy, coshy, sinhy);
+			ah[k]			= epochPointK.ah;
+			aw[k]			= epochPointK.aw;
 		}
 		double dnpod1 = fabs(dpod);
 		double dnpod2 = 1 - dnpod1;
@@ -1,9 +1,12 @@
 
 // #pragma GCC optimize ("O0")
 
+#include <algorithm>
 #include <fstream>
+#include <set>
 
 using std::ifstream;
+using std::set;
 
 #include "tropModels.hpp"
 
@@ -51,7 +54,16 @@ struct Vmf3GridPoint
 	}
 };
 
-struct Vmf3 : map<GTime, map<double, map<double, Vmf3GridPoint>>>	/* VMF gridmap [time][lat][lon] plus orography vector */
+/** vmf3 grid for a single epoch, stored densely as rows of constant latitude
+ */
+struct Vmf3Grid
+{
+	vector<double>			latList;		///< grid latitudes (degree), ascending
+	vector<double>			lonList;		///< grid longitudes (degree), ascending
+	vector<Vmf3GridPoint>	pointList;		///< grid points, as pointList[latIndex * lonList.size() + lonIndex]
+};
+
+struct Vmf3 : map<GTime, Vmf3Grid>	/* VMF grids [time] plus orography vector */
 {
 	vector<double>	orography;
 
@@ -880,6 +892,8 @@ void readvmf3(
 	int index = 0;
 	GTime time = GTime::noTime();
 
+	map<GTime, vector<Vmf3GridPoint>> pointListMap;
+
 	while (filestream)
 	{
 		string line;
@@ -928,7 +942,34 @@ void readvmf3(
 
 		if (found == 6)
 		{
-			globalVMF3[time][gridPoint.lat][gridPoint.lon] = gridPoint;
+			pointListMap[time].push_back(gridPoint);
+		}
+	}
+
+	//arrange the points of each epoch into dense grids
+	for (auto& [time, pointList] : pointListMap)
+	{
+		set<double> latSet;
+		set<double> lonSet;
+
+		for (auto& gridPoint : pointList)
+		{
+			latSet.insert(gridPoint.lat);
+			lonSet.insert(gridPoint.lon);
+		}
+
+		auto& grid = globalVMF3[time];
+
+		grid.latList.assign(latSet.begin(), latSet.end());
+		grid.lonList.assign(lonSet.begin(), lonSet.end());
+		grid.pointList.assign(grid.latList.size() * grid.lonList.size(), Vmf3GridPoint());
+
+		for (auto& gridPoint : pointList)
+		{
+			int latIndex = std::lower_bound(grid.latList.begin(), grid.latList.end(), gridPoint.lat) - grid.latList.begin();
+			int lonIndex = std::lower_bound(grid.lonList.begin(), grid.lonList.end(), gridPoint.lon) - grid.lonList.begin();
+
+			grid.pointList[latIndex * grid.lonList.size() + lonIndex] = gridPoint;
 		}
 	}
 
@@ -1108,6 +1149,35 @@ vector<const VALTYPE*> getStraddle(
 	return outputs;
 }
 
+/** Find the entries of an ascending list that straddle a value, using the same conventions as getStraddle()
+ */
+void getStraddle(
+	const vector<double>&	list,			///< Ascending list of grid values
+	double					inter,			///< Value to find the straddling entries of
+	int						indices[2],		///< Indices of the straddling entries
+	double					fractions[2])	///< Weights of the straddling entries
+{
+	int it = std::lower_bound(list.begin(), list.end(), inter) - list.begin();
+	if (it == list.size())
+	{
+		indices[0] = it - 1;		fractions[0] = 1;
+		indices[1] = it - 1;		fractions[1] = 0;
+	}
+	else if (it == 0)
+	{
+		indices[0] = it;			fractions[0] = 0;
+		indices[1] = it;			fractions[1] = 1;
+	}
+	else
+	{
+		double inter2 = list[it];
+		double inter1 = list[it - 1];
+
+		indices[0] = it;			fractions[0] = (inter - inter1) / (inter2 - inter1);
+		indices[1] = it - 1;		fractions[1] = (inter - inter1) / (inter1 - inter2) + 1;
+	}
+}
+
 /** vmf3
  */
 double tropVMF3(
@@ -1140,28 +1210,37 @@ double tropVMF3(
 	Vmf3GridPoint timePoint;
 	for (int i = 0; i < 2; i++)
 	{
-		vector<double> fractionsb;
-		auto& A = *a[i];
-		auto b = getStraddle(A, latd, fractionsb);
+		auto& grid = *a[i];
+
+		if (grid.pointList.empty())
+			continue;
+
+		//the grids share their layout, but look up each in case they dont
+		int		latIndices[2];
+		int		lonIndices[2];
+		double	fractionsb[2];
+		double	fractionsc[2];
+		getStraddle(grid.latList, latd, latIndices, fractionsb);
+		getStraddle(grid.lonList, lond, lonIndices, fractionsc);
+
+		int nLon = grid.lonList.size();
 
 		Vmf3GridPoint latPoint;
-		for (int i = 0; i < 2; i++)
+		for (int j = 0; j < 2; j++)
 		{
-			vector<double> fractionsc;
-			auto& B = *b[i];
-			auto c = getStraddle(B, lond, fractionsc);
+			const Vmf3GridPoint* row = &grid.pointList[latIndices[j] * nLon];
 
 			Vmf3GridPoint lonPoint;
-			for (int i = 0; i < 2; i++)
+			for (int k = 0; k < 2; k++)
 			{
-				Vmf3GridPoint vmf3GP = *c[i];
+				Vmf3GridPoint vmf3GP = row[lonIndices[k]];
 				{
 					vmf3GP.orog = globalVMF3.orography[vmf3GP.index];
 				}
 
-				lonPoint += vmf3GP * fractionsc[i];
+				lonPoint += vmf3GP * fractionsc[k];
 			}
-			latPoint += lonPoint * fractionsb[i];
+			latPoint += lonPoint * fractionsb[j];
 		}
 		timePoint += latPoint * fractionsa[i];
 	}